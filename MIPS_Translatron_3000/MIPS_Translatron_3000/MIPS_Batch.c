@@ -0,0 +1,1035 @@
+#include "MIPS_Batch.h"
+#include "MIPS_Instruction.h"
+#include "MIPS_Ingest.h"
+#include "MIPS_Symbols.h"
+#include "MIPS_Thread.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// a line that couldn't be assembled
+typedef struct {
+	uint32_t line;		// the line number within its chunk
+	uint16_t state;		// the error
+} Line_Error;
+
+// a run of whole lines whose labels are listed by one thread in pass one, the same lines as an Assemble_Chunk
+typedef struct {
+	const char* data;		// the first line
+	size_t len;				// the number of bytes, ending after a newline unless it is the end of the file
+	uint32_t lines;			// the number of lines in the chunk
+	uint32_t words;			// the number of lines with an instruction, each takes a word even if it has an error
+	uint32_t address;		// the byte address of the first word, from the prefix sum of words
+	uint32_t line_base;		// the number of lines before the chunk, from the prefix sum of lines
+	Symbol_List labels;		// the labels the chunk defines, kept until pass two is done
+	Symbol_Table* symbols;	// the table the labels are merged into
+	int failed;				// set if a label couldn't be listed or merged, the rest of the chunk is skipped
+} Label_Chunk;
+
+// a run of whole lines assembled by one thread into its own output
+typedef struct {
+	const char* data;		// the first line
+	size_t len;				// the number of bytes, ending after a newline unless it is the end of the file
+	char* out;				// the hex words, kept between rounds
+	size_t out_len;
+	size_t out_capacity;
+	Line_Error* errors;		// lines that couldn't be assembled, kept between rounds
+	size_t error_count;
+	size_t error_capacity;
+	uint32_t lines;			// the number of lines in the chunk
+	const Label_Chunk* labels;	// the same lines from pass one, with the address of the first word and the labels they define
+	const Symbol_Table* symbols;	// the labels of the file, empty if it has none
+	int failed;				// set if memory couldn't be allocated, the rest of the chunk is skipped
+} Assemble_Chunk;
+
+// a range of words of a raw image disassembled by one thread into its own listing
+typedef struct {
+	const uint8_t* bytes;	// the first word
+	size_t words;			// the number of words
+	uint32_t address;		// the byte address of the first word
+	Word_Format format;		// FORMAT_RAW_BE or FORMAT_RAW_LE
+	char* out;				// DISASSEMBLE_CHUNK_WORDS * LISTING_LINE_SIZE bytes
+	size_t out_len;
+} Disassemble_Chunk;
+
+/*----------------------------\
+		  Batch Mode
+\----------------------------*/
+/*
+	Purpose: prints how to use batch mode
+	Params: const char* program - the name the program was run with
+	Return: none
+*/
+static void printUsage(const char* program) {
+	fprintf(stderr, "Usage: %s -a <input.s> [-o <output>] [-j <count>]\n", program);
+	fprintf(stderr, "       %s -d <input> [-f hex|bin|be|le] [-o <output>] [-j <count>]\n", program);
+	fputs("\t-a <file>\tassemble every line of <file> into hex machine code\n", stderr);
+	fputs("\t\t\tlines can start with a label, like \"loop:\", for BEQ and BNE to branch to\n", stderr);
+	fputs("\t-d <file>\tdisassemble every word of <file> into an addressed listing\n", stderr);
+	fputs("\t-f <format>\thow -d words are stored: hex or bin text, one word per line (default hex),\n", stderr);
+	fputs("\t\t\tor a raw big endian (be) or little endian (le) binary image\n", stderr);
+	fputs("\t-o <file>\twrite the output to <file> instead of the console\n", stderr);
+	fputs("\t-j <count>\tnumber of threads to use (default one per processor)\n", stderr);
+	fputs("Run without any arguments for the interactive menu\n", stderr);
+}
+
+/*
+	Purpose: runs batch mode from the command line arguments
+	Params: int argc - the number of arguments
+			char** argv - the arguments given to main
+	Return: int - the exit code for the program
+*/
+int runBatch(int argc, char** argv) {
+	const char* in_name = NULL;
+	const char* out_name = NULL;
+	const char* format_name = "hex";
+	uint32_t threads = threadCount();
+	char mode = '\0';
+
+	// reads the options, each one takes a value
+	for (int i = 1; i < argc; i++) {
+		if (((strcmp(argv[i], "-a") == 0) || (strcmp(argv[i], "-d") == 0)) && (i + 1 < argc) && (mode == '\0')) {
+			mode = argv[i][1];
+			in_name = argv[++i];
+		}
+		else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc)) {
+			out_name = argv[++i];
+		}
+		else if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc)) {
+			format_name = argv[++i];
+		}
+		else if ((strcmp(argv[i], "-j") == 0) && (i + 1 < argc) && (atoi(argv[i + 1]) >= 1)) {
+			threads = (uint32_t)atoi(argv[++i]);
+			threads = (threads > MAX_THREADS) ? MAX_THREADS : threads;
+		}
+		else {
+			printUsage(argv[0]);
+			return 2;
+		}
+	}
+
+	Word_Format format;
+	if (strcmp(format_name, "hex") == 0) { format = FORMAT_HEX; }
+	else if (strcmp(format_name, "bin") == 0) { format = FORMAT_BIN; }
+	else if (strcmp(format_name, "be") == 0) { format = FORMAT_RAW_BE; }
+	else if (strcmp(format_name, "le") == 0) { format = FORMAT_RAW_LE; }
+	else {
+		printUsage(argv[0]);
+		return 2;
+	}
+
+	if (in_name == NULL) {
+		printUsage(argv[0]);
+		return 2;
+	}
+
+	FILE* in = fopen(in_name, "rb");
+	if (in == NULL) {
+		fprintf(stderr, "ERROR: Could not open %s\n", in_name);
+		return 1;
+	}
+
+	FILE* out = stdout;
+	if (out_name != NULL) {
+		out = fopen(out_name, "wb");
+		if (out == NULL) {
+			fprintf(stderr, "ERROR: Could not create %s\n", out_name);
+			fclose(in);
+			return 1;
+		}
+	}
+
+	uint32_t errors;
+	if (mode == 'a') {
+		errors = assembleFile(in, out, in_name, threads);
+	}
+	else {
+		errors = disassembleFile(in, out, in_name, format, threads);
+	}
+
+	fclose(in);
+	if ((out != stdout) && (fclose(out) != 0)) {
+		fprintf(stderr, "ERROR: Could not finish writing %s\n", out_name);
+		return 1;
+	}
+
+	if (errors > 0) {
+		fprintf(stderr, "%u line(s) could not be %s\n", errors, (mode == 'a') ? "assembled" : "disassembled");
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+	Purpose: records a line that couldn't be assembled
+	Params: Assemble_Chunk* chunk - the chunk the line is in
+			uint32_t line - the line number within the chunk
+			uint16_t state - the error
+	Return: none
+*/
+static void addLineError(Assemble_Chunk* chunk, uint32_t line, uint16_t state) {
+	if (chunk->error_count == chunk->error_capacity) {
+		size_t capacity = (chunk->error_capacity == 0) ? 64 : chunk->error_capacity * 2;
+		Line_Error* bigger = realloc(chunk->errors, capacity * sizeof(Line_Error));
+
+		if (bigger == NULL) {
+			chunk->failed = 1;
+			return;
+		}
+
+		chunk->errors = bigger;
+		chunk->error_capacity = capacity;
+	}
+
+	chunk->errors[chunk->error_count].line = line;
+	chunk->errors[chunk->error_count].state = state;
+	chunk->error_count++;
+}
+
+/*
+	Purpose: splits the next line off a chunk without its newline or carriage return, skipping
+			 leading whitespace and any label definition in front of the instruction
+	Params: const char** pos - the position in the chunk, moved past the line
+			const char* end - one past the last character of the chunk
+			const char** label - filled with the label the line defines, NULL if there isn't one
+			size_t* label_len - filled with the length of the label
+			size_t* len - filled with the length of the instruction, 0 for a line without one
+	Return: const char* - the start of the instruction
+*/
+static const char* chunkLine(const char** pos, const char* end, const char** label, size_t* label_len, size_t* len) {
+	// the last line of the chunk doesn't need a newline
+	const char* line = *pos;
+	const char* newline = memchr(line, '\n', (size_t)(end - line));
+	*len = (newline != NULL) ? (size_t)(newline - line) : (size_t)(end - line);
+	*pos = line + *len + 1;
+
+	if ((*len > 0) && (line[*len - 1] == '\r')) { (*len)--; }
+
+	// eat any leading whitespace
+	while ((*len > 0) && charIs(*line, CHAR_BLANK)) { line++; (*len)--; }
+
+	// a label is followed by a ':', then the instruction can be on the same line
+	*label_len = labelDefinition(line, *len);
+	*label = (*label_len > 0) ? line : NULL;
+
+	if (*label_len > 0) {
+		line += *label_len + 1;
+		*len -= *label_len + 1;
+
+		while ((*len > 0) && charIs(*line, CHAR_BLANK)) { line++; (*len)--; }
+	}
+
+	return line;
+}
+
+/*
+	Purpose: assembles every line of a chunk into its own output, run by the worker threads
+	Params: void* arg - the Assemble_Chunk to work on
+	Return: none
+*/
+static void assembleChunk(void* arg) {
+	Assemble_Chunk* chunk = arg;
+	const char* pos = chunk->data;
+	const char* end = chunk->data + chunk->len;
+	Label_Scope scope = { chunk->symbols, chunk->labels->address };
+
+	chunk->out_len = 0;
+	chunk->error_count = 0;
+	chunk->lines = 0;
+	chunk->failed = 0;
+
+	while (pos < end) {
+		const char* label;
+		size_t label_len;
+		size_t len;
+
+		const char* line = chunkLine(&pos, end, &label, &label_len, &len);
+		chunk->lines++;
+
+		// blank lines and lines with only a label don't produce a word
+		if (len == 0) {
+			continue;
+		}
+
+		// parses and encodes the instruction in place in one pass, at the address pass one gave it
+		uint32_t word;
+		uint16_t state = assembleLine(line, len, &scope, &word);
+		scope.address += 4;
+
+		if (state != COMPLETE_ENCODE) {
+			addLineError(chunk, chunk->lines, state);
+			continue;
+		}
+
+		// grows the output if another word won't fit
+		if (chunk->out_len + 9 > chunk->out_capacity) {
+			size_t capacity = (chunk->out_capacity < 4096) ? 4096 : chunk->out_capacity * 2;
+			char* bigger = realloc(chunk->out, capacity);
+
+			if (bigger == NULL) {
+				chunk->failed = 1;
+				return;
+			}
+
+			chunk->out = bigger;
+			chunk->out_capacity = capacity;
+		}
+
+		// writes the word as 8 hex digits
+		char* out = appendHex32(chunk->out + chunk->out_len, word);
+		*out++ = '\n';
+		chunk->out_len = (size_t)(out - chunk->out);
+	}
+}
+
+/*
+	Purpose: finds where the chunk starting at a position ends
+	Params: const Mapped_Input* input - the assembly being read
+			size_t start - the offset of the first line of the chunk
+	Return: size_t - the offset after the chunk, which ends after the first newline at or past
+			ASSEMBLE_CHUNK_SIZE bytes so lines are never split
+*/
+static size_t chunkEnd(const Mapped_Input* input, size_t start) {
+	if (input->size - start <= ASSEMBLE_CHUNK_SIZE) {
+		return input->size;
+	}
+
+	const char* newline = memchr(input->data + start + ASSEMBLE_CHUNK_SIZE - 1, '\n', input->size - (start + ASSEMBLE_CHUNK_SIZE - 1));
+	return (newline == NULL) ? input->size : (size_t)(newline - input->data) + 1;
+}
+
+/*
+	Purpose: lists the labels a chunk defines and counts its lines and the words it assembles
+			 to, run by the worker threads in pass one
+	Params: void* arg - the Label_Chunk to work on
+	Return: none
+*/
+static void labelChunk(void* arg) {
+	Label_Chunk* chunk = arg;
+	const char* pos = chunk->data;
+	const char* end = chunk->data + chunk->len;
+
+	while (pos < end) {
+		const char* label;
+		size_t label_len;
+		size_t len;
+
+		chunkLine(&pos, end, &label, &label_len, &len);
+		chunk->lines++;
+
+		// the address and line are within the chunk until the prefix sum places it
+		if ((label != NULL) && (listSymbol(&chunk->labels, label, (uint32_t)label_len, chunk->words * 4, chunk->lines) != 0)) {
+			chunk->failed = 1;
+			return;
+		}
+
+		// every line with an instruction takes a word, even if it can't be assembled
+		if (len > 0) {
+			chunk->words++;
+		}
+	}
+}
+
+/*
+	Purpose: moves the labels of a chunk to their place in the file and merges them into the
+			 symbol table, run by the worker threads once every chunk has been placed
+	Params: void* arg - the Label_Chunk to work on
+	Return: none
+*/
+static void mergeChunk(void* arg) {
+	Label_Chunk* chunk = arg;
+
+	for (uint32_t i = 0; i < chunk->labels.count; i++) {
+		Symbol* symbol = &chunk->labels.symbols[i];
+		symbol->address += chunk->address;
+		symbol->line += chunk->line_base;
+
+		if (mergeSymbol(chunk->symbols, symbol) == SYMBOL_NO_MEMORY) {
+			chunk->failed = 1;
+		}
+	}
+}
+
+/*
+	Purpose: frees the label lists of the chunks of pass one and the chunks
+	Params: Label_Chunk* chunks - the chunks, can be NULL
+			size_t count - the number of chunks labelPass filled
+	Return: none
+*/
+static void freeLabelChunks(Label_Chunk* chunks, size_t count) {
+	for (size_t i = 0; (chunks != NULL) && (i < count); i++) {
+		freeSymbolList(&chunks[i].labels);
+	}
+
+	free(chunks);
+}
+
+/*
+	Purpose: checks if a file can define labels, releasing its pages as the search goes so a
+			 file without any doesn't end up entirely in memory
+	Params: Mapped_Input* input - the assembly being read
+	Return: int - 1 if the file has a ':', 0 if it doesn't
+*/
+static int hasLabels(Mapped_Input* input) {
+	while (input->pos < input->size) {
+		size_t len = (input->size - input->pos < MAP_RELEASE_SIZE) ? input->size - input->pos : MAP_RELEASE_SIZE;
+
+		if (memchr(input->data + input->pos, ':', len) != NULL) {
+			return 1;
+		}
+
+		input->pos += len;
+		releaseInput(input);
+	}
+
+	return 0;
+}
+
+/*
+	Purpose: splits a file into chunks, lists the labels of every chunk at once and gives each
+			 chunk its address, the first half of pass one
+	Params: Mapped_Input* input - the assembly being read, its pages are released behind each round
+			Label_Chunk* chunks - the chunks to fill, zeroed, one for every ASSEMBLE_CHUNK_SIZE bytes plus one
+			Thread_Pool* pool - the threads to list labels with
+			uint32_t threads - the number of chunks to list at once, 1 to MAX_THREADS
+			uint32_t* label_count - filled with the number of labels in the file
+	Return: size_t - the number of chunks
+*/
+static size_t labelPass(Mapped_Input* input, Label_Chunk* chunks, Thread_Pool* pool, uint32_t threads, uint32_t* label_count) {
+	size_t count = 0;
+
+	// the chunks are split the same way pass two splits them
+	for (size_t start = 0; start < input->size; count++) {
+		size_t end = chunkEnd(input, start);
+
+		chunks[count].data = input->data + start;
+		chunks[count].len = end - start;
+		start = end;
+	}
+
+	for (size_t first = 0; first < count; first += threads) {
+		uint32_t used = (count - first < threads) ? (uint32_t)(count - first) : threads;
+		runPool(pool, labelChunk, &chunks[first], sizeof(Label_Chunk), used);
+
+		// the labels are copied into the lists, so the lines of the round can be dropped like in pass two
+		const Label_Chunk* last = &chunks[first + used - 1];
+		input->pos = (size_t)(last->data + last->len - input->data);
+		releaseInput(input);
+	}
+
+	// a prefix sum of the words and lines before each chunk gives it its place in the file
+	uint32_t address = 0;
+	uint32_t line_base = 0;
+	*label_count = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		chunks[i].address = address;
+		chunks[i].line_base = line_base;
+
+		address += chunks[i].words * 4;
+		line_base += chunks[i].lines;
+		*label_count += chunks[i].labels.count;
+	}
+
+	return count;
+}
+
+/*
+	Purpose: merges the labels of every chunk into the symbol table at once, the second half
+			 of pass one
+	Params: Label_Chunk* chunks - the chunks labelPass filled
+			size_t count - the number of chunks
+			Symbol_Table* symbols - the table to merge into, with room for every label
+			Thread_Pool* pool - the threads to merge with
+	Return: none
+*/
+static void mergeLabels(Label_Chunk* chunks, size_t count, Symbol_Table* symbols, Thread_Pool* pool) {
+	for (size_t i = 0; i < count; i++) {
+		chunks[i].symbols = symbols;
+	}
+
+	// the labels are already in memory, so every chunk is handed out at once
+	runPool(pool, mergeChunk, chunks, sizeof(Label_Chunk), (uint32_t)count);
+}
+
+/*
+	Purpose: prints an error on a line of the file
+	Params: const char* name - the input name used in error messages
+			uint32_t line - the line number in the file
+			uint16_t state - the error
+	Return: none
+*/
+static void printLineError(const char* name, uint32_t line, uint16_t state) {
+	fprintf(stderr, "%s:%u: ERROR: %s\n", name, line, stateMessage(state));
+}
+
+/*
+	Purpose: prints the errors of a chunk from both passes with their line numbers in the file,
+			 in line order
+	Params: const Assemble_Chunk* chunk - the chunk that was assembled
+			const char* name - the input name used in error messages
+			uint32_t line_base - the number of lines before the chunk
+	Return: uint32_t - the number of errors printed
+*/
+static uint32_t reportChunk(const Assemble_Chunk* chunk, const char* name, uint32_t line_base) {
+	const Label_Chunk* labels = chunk->labels;
+	uint32_t errors = (uint32_t)chunk->error_count;
+	size_t e = 0;
+
+	for (uint32_t i = 0; i < labels->labels.count; i++) {
+		const Symbol* symbol = &labels->labels.symbols[i];
+
+		// every definition that isn't the one in the table lost to an earlier line with the same name
+		if (findSymbol(labels->symbols, symbol->name, symbol->len) == symbol) {
+			continue;
+		}
+
+		// a label comes before the instruction on its line, so its error does too
+		for (; (e < chunk->error_count) && (line_base + chunk->errors[e].line < symbol->line); e++) {
+			printLineError(name, line_base + chunk->errors[e].line, chunk->errors[e].state);
+		}
+
+		printLineError(name, symbol->line, DUPLICATE_LABEL);
+		errors++;
+	}
+
+	for (; e < chunk->error_count; e++) {
+		printLineError(name, line_base + chunk->errors[e].line, chunk->errors[e].state);
+	}
+
+	if (labels->failed) {
+		fprintf(stderr, "%s:%u: ERROR: Could not allocate memory for the labels after this line\n", name, labels->line_base + labels->lines);
+		errors++;
+	}
+
+	if (chunk->failed) {
+		fprintf(stderr, "%s:%u: ERROR: Could not allocate memory for the lines after this one\n", name, line_base + chunk->lines);
+		errors++;
+	}
+
+	return errors;
+}
+
+/*
+	Purpose: hands the next chunks of a file to a round of pass two, one for each thread
+	Params: Assemble_Chunk* chunks - the chunks of the round
+			uint32_t threads - the number of threads, 1 to MAX_THREADS
+			const Mapped_Input* input - the assembly being read
+			size_t* pos - the offset of the next chunk, moved past the round
+			const Label_Chunk** labels - the pass one chunk of the next chunk, moved past the round
+			const Symbol_Table* symbols - the labels of the file
+	Return: uint32_t - the number of chunks in the round, 0 at the end of the file
+*/
+static uint32_t fillRound(Assemble_Chunk* chunks, uint32_t threads, const Mapped_Input* input, size_t* pos, const Label_Chunk** labels, const Symbol_Table* symbols) {
+	uint32_t used = 0;
+
+	while ((used < threads) && (*pos < input->size)) {
+		size_t end = chunkEnd(input, *pos);
+
+		chunks[used].data = input->data + *pos;
+		chunks[used].len = end - *pos;
+		chunks[used].labels = (*labels)++;
+		chunks[used].symbols = symbols;
+		*pos = end;
+		used++;
+	}
+
+	return used;
+}
+
+/*
+	Purpose: assembles every line of a file into hex machine code, one word per line
+	Params: FILE* in - the assembly to read
+			FILE* out - where to write the machine code
+			const char* name - the input name used in error messages
+			uint32_t threads - the number of threads to assemble with, 1 to MAX_THREADS
+	Return: uint32_t - the number of lines that had errors
+*/
+uint32_t assembleFile(FILE* in, FILE* out, const char* name, uint32_t threads) {
+	Mapped_Input input;
+	Out_Buffer output;
+	Symbol_Table symbols;
+	Assemble_Chunk chunks[2][MAX_THREADS];
+
+	if (mapInput(&input, in) != 0) {
+		fprintf(stderr, "ERROR: Could not read %s\n", name);
+		return 1;
+	}
+
+	// every chunk has at least ASSEMBLE_CHUNK_SIZE bytes except the last
+	Label_Chunk* label_chunks = calloc((input.size / ASSEMBLE_CHUNK_SIZE) + 1, sizeof(Label_Chunk));
+	size_t label_chunk_count = 0;
+	uint32_t label_count = 0;
+
+	if (threads < 1) { threads = 1; }
+	if (threads > MAX_THREADS) { threads = MAX_THREADS; }
+	memset(chunks, 0, sizeof(chunks));
+
+	// the threads are started once for both passes
+	Thread_Pool* pool = startPool(threads);
+
+	// only a file with a ':' can define labels, any other file is assembled in one pass
+	if ((label_chunks != NULL) && hasLabels(&input)) {
+		label_chunk_count = labelPass(&input, label_chunks, pool, threads, &label_count);
+	}
+
+	// pass two reads the file again from the start, faulting back in the pages pass one released
+	input.pos = 0;
+	input.released = 0;
+
+	// the table is sized for every label up front, so threads can merge into it without it moving
+	int failed = openOutput(&output, out);
+	failed |= initSymbols(&symbols, label_count);
+
+	if (failed || (label_chunks == NULL)) {
+		fputs("ERROR: Could not allocate the batch buffers\n", stderr);
+		free(output.data);
+		freeSymbols(&symbols);
+		freeLabelChunks(label_chunks, label_chunk_count);
+		stopPool(pool);
+		unmapInput(&input);
+		return 1;
+	}
+
+	mergeLabels(label_chunks, label_chunk_count, &symbols, pool);
+
+	uint32_t errors = 0;
+	uint32_t line_base = 0;
+	size_t pos = 0;
+	const Label_Chunk* labels = label_chunks;
+	uint32_t set = 0;
+
+	// each round hands one chunk to each thread, the threads assemble the next round while the last one is written out in order
+	uint32_t used = fillRound(chunks[set], threads, &input, &pos, &labels, &symbols);
+	submitPool(pool, assembleChunk, chunks[set], sizeof(Assemble_Chunk), used);
+
+	while (used > 0) {
+		waitPool(pool);
+
+		uint32_t next_used = fillRound(chunks[set ^ 1], threads, &input, &pos, &labels, &symbols);
+		submitPool(pool, assembleChunk, chunks[set ^ 1], sizeof(Assemble_Chunk), next_used);
+
+		for (uint32_t i = 0; i < used; i++) {
+			errors += reportChunk(&chunks[set][i], name, line_base);
+			writeOutput(&output, chunks[set][i].out, chunks[set][i].out_len);
+			line_base += chunks[set][i].lines;
+		}
+
+		// only the pages of the round that was written are dropped, the next round is still being read
+		const Assemble_Chunk* last = &chunks[set][used - 1];
+		input.pos = (size_t)(last->data + last->len - input.data);
+		releaseInput(&input);
+
+		set ^= 1;
+		used = next_used;
+	}
+
+	stopPool(pool);
+	for (uint32_t i = 0; i < threads; i++) {
+		free(chunks[0][i].out);
+		free(chunks[0][i].errors);
+		free(chunks[1][i].out);
+		free(chunks[1][i].errors);
+	}
+
+	freeSymbols(&symbols);
+	freeLabelChunks(label_chunks, label_chunk_count);
+	unmapInput(&input);
+	if (closeOutput(&output) != 0) {
+		fprintf(stderr, "ERROR: Could not write the output for %s\n", name);
+		errors++;
+	}
+
+	return errors;
+}
+
+
+/*
+	Purpose: counts the newlines in part of the input
+	Params: const char* data - the start of the part to count
+			size_t len - the number of characters to count through
+	Return: uint32_t - the number of newlines
+*/
+static uint32_t countLines(const char* data, size_t len) {
+	const char* end = data + len;
+	uint32_t lines = 0;
+
+	while ((data = memchr(data, '\n', (size_t)(end - data))) != NULL) {
+		lines++;
+		data++;
+	}
+
+	return lines;
+}
+
+/*
+	Purpose: decodes a word and formats its line of the listing
+	Params: char* pos - where to write, at least LISTING_LINE_SIZE bytes
+			uint32_t word - the word to decode
+			uint32_t address - the byte address of the word
+	Return: char* - the position after the newline
+*/
+static char* formatListing(char* pos, uint32_t word, uint32_t address) {
+	pos = appendHex32(pos, address);
+	pos = appendStr(pos, ": ", 2);
+
+	// words that aren't instructions are listed as data
+	size_t len = formatWord(pos, word);
+	if (len > 0) {
+		pos += len;
+	}
+	else {
+		pos = appendStr(pos, ".word 0x", 8);
+		pos = appendHex32(pos, word);
+	}
+
+	*pos++ = '\n';
+	return pos;
+}
+
+/*
+	Purpose: decodes a word and adds its line to the listing
+	Params: Out_Buffer* output - where to write the line
+			uint32_t word - the word to decode
+			uint32_t address - the byte address of the word
+	Return: none
+*/
+static void writeListing(Out_Buffer* output, uint32_t word, uint32_t address) {
+	// the line is formatted straight into the output buffer
+	char* pos = reserveOutput(output, LISTING_LINE_SIZE);
+	commitOutput(output, formatListing(pos, word, address));
+}
+
+/*
+	Purpose: disassembles a range of words of a raw image into its own listing, run by the worker threads
+	Params: void* arg - the Disassemble_Chunk to work on
+	Return: none
+*/
+static void disassembleChunk(void* arg) {
+	Disassemble_Chunk* chunk = arg;
+	const uint8_t* bytes = chunk->bytes;
+	uint32_t address = chunk->address;
+	char* pos = chunk->out;
+
+	for (size_t i = 0; i < chunk->words; i++, bytes += 4, address += 4) {
+		uint32_t word;
+
+		if (chunk->format == FORMAT_RAW_BE) {
+			word = ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+		}
+		else {
+			word = ((uint32_t)bytes[3] << 24) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[1] << 8) | bytes[0];
+		}
+
+		pos = formatListing(pos, word, address);
+	}
+
+	chunk->out_len = (size_t)(pos - chunk->out);
+}
+
+/*
+	Purpose: hands the next ranges of a raw image to a round, one for each thread
+	Params: Disassemble_Chunk* chunks - the ranges of the round
+			uint32_t threads - the number of threads
+			const Mapped_Input* input - the image being read
+			size_t* next - the index of the next word, moved past the round
+			size_t words - the number of whole words in the image
+			uint32_t* address - the byte address of the next word, moved past the round
+			Word_Format format - FORMAT_RAW_BE or FORMAT_RAW_LE
+	Return: uint32_t - the number of ranges in the round, 0 at the end of the image
+*/
+static uint32_t fillRanges(Disassemble_Chunk* chunks, uint32_t threads, const Mapped_Input* input, size_t* next, size_t words, uint32_t* address, Word_Format format) {
+	uint32_t used = 0;
+
+	while ((used < threads) && (*next < words)) {
+		size_t count = words - *next;
+		count = (count > DISASSEMBLE_CHUNK_WORDS) ? DISASSEMBLE_CHUNK_WORDS : count;
+
+		chunks[used].bytes = (const uint8_t*)input->data + (*next * 4);
+		chunks[used].words = count;
+		chunks[used].address = *address;
+		chunks[used].format = format;
+
+		*address += (uint32_t)(count * 4);
+		*next += count;
+		used++;
+	}
+
+	return used;
+}
+
+/*
+	Purpose: disassembles every word of a file into an addressed assembly listing
+	Params: FILE* in - the machine code to read
+			FILE* out - where to write the listing
+			const char* name - the input name used in error messages
+			Word_Format format - how the words are stored in the input
+			uint32_t threads - the number of threads to disassemble raw images with, 1 to MAX_THREADS
+	Return: uint32_t - the number of words that couldn't be read
+*/
+uint32_t disassembleFile(FILE* in, FILE* out, const char* name, Word_Format format, uint32_t threads) {
+	Mapped_Input input;
+	Out_Buffer output;
+
+	// raw images are read straight out of the mapped file, just without splitting lines
+	if (mapInput(&input, in) != 0) {
+		fprintf(stderr, "ERROR: Could not read %s\n", name);
+		return 1;
+	}
+	if (openOutput(&output, out) != 0) {
+		fputs("ERROR: Could not allocate the batch buffers\n", stderr);
+		unmapInput(&input);
+		return 1;
+	}
+
+	uint32_t errors = 0;
+	uint32_t address = 0;
+
+	if ((format == FORMAT_RAW_BE) || (format == FORMAT_RAW_LE)) {
+		Disassemble_Chunk chunks[2][MAX_THREADS];
+		char* parts[MAX_THREADS];
+		size_t lens[MAX_THREADS];
+		size_t len = input.size;
+		size_t words = len / 4;
+		size_t next = 0;
+
+		if (threads < 1) { threads = 1; }
+		if (threads > MAX_THREADS) { threads = MAX_THREADS; }
+
+		// every thread gets a listing big enough for a whole range in each of the two rounds in flight,
+		// fewer threads are used if they can't all be allocated
+		uint32_t buffers = 0;
+		while (buffers < threads) {
+			chunks[0][buffers].out = malloc((size_t)DISASSEMBLE_CHUNK_WORDS * LISTING_LINE_SIZE);
+			chunks[1][buffers].out = malloc((size_t)DISASSEMBLE_CHUNK_WORDS * LISTING_LINE_SIZE);
+			if ((chunks[0][buffers].out == NULL) || (chunks[1][buffers].out == NULL)) {
+				free(chunks[0][buffers].out);
+				free(chunks[1][buffers].out);
+				break;
+			}
+			buffers++;
+		}
+
+		if ((buffers == 0) && (words > 0)) {
+			fputs("ERROR: Could not allocate the batch buffers\n", stderr);
+			errors++;
+			words = 0;
+		}
+
+		Thread_Pool* pool = startPool(buffers);
+		uint32_t set = 0;
+
+		// each round hands one range to each thread, the threads disassemble the next round while the last one is written out in order
+		uint32_t used = fillRanges(chunks[set], buffers, &input, &next, words, &address, format);
+		submitPool(pool, disassembleChunk, chunks[set], sizeof(Disassemble_Chunk), used);
+
+		while (used > 0) {
+			waitPool(pool);
+
+			uint32_t next_used = fillRanges(chunks[set ^ 1], buffers, &input, &next, words, &address, format);
+			submitPool(pool, disassembleChunk, chunks[set ^ 1], sizeof(Disassemble_Chunk), next_used);
+
+			for (uint32_t i = 0; i < used; i++) {
+				parts[i] = chunks[set][i].out;
+				lens[i] = chunks[set][i].out_len;
+			}
+			writeOutputParts(&output, parts, lens, used);
+
+			// only the pages of the round that was written are dropped, the next round is still being read
+			const Disassemble_Chunk* last = &chunks[set][used - 1];
+			input.pos = (size_t)(last->bytes + (last->words * 4) - (const uint8_t*)input.data);
+			releaseInput(&input);
+
+			set ^= 1;
+			used = next_used;
+		}
+
+		stopPool(pool);
+		for (uint32_t i = 0; i < buffers; i++) {
+			free(chunks[0][i].out);
+			free(chunks[1][i].out);
+		}
+
+		if (len % 4 != 0) {
+			fprintf(stderr, "%s: ERROR: %u trailing byte(s) don't make up a whole word\n", name, (uint32_t)(len % 4));
+			errors++;
+		}
+	}
+	else {
+		// words are converted a block at a time straight out of the input, lines are only counted for errors
+		Ingest_Result (*ingest)(const char*, size_t, uint32_t*, size_t) = (format == FORMAT_HEX) ? ingestHexWords : ingestBinWords;
+		uint32_t words[INGEST_BLOCK];
+		uint32_t line_num = 1;
+		size_t counted = 0;
+		size_t pos = 0;
+
+		while (pos < input.size) {
+			Ingest_Result result = ingest(input.data + pos, input.size - pos, words, INGEST_BLOCK);
+
+			for (size_t i = 0; i < result.count; i++, address += 4) {
+				writeListing(&output, words[i], address);
+			}
+
+			pos += result.offset;
+			input.pos = pos;
+			releaseInput(&input);
+
+			if (result.malformed) {
+				// reports the rest of the line from the bad word
+				const char* token = input.data + pos;
+				const char* newline = memchr(token, '\n', input.size - pos);
+				size_t token_len = ((newline == NULL) ? input.size : (size_t)(newline - input.data)) - pos;
+				if ((token_len > 0) && (token[token_len - 1] == '\r')) { token_len--; }
+
+				line_num += countLines(input.data + counted, pos - counted);
+				fprintf(stderr, "%s:%u: ERROR: Expected a %s word, found \"%.*s\"\n", name, line_num, (format == FORMAT_HEX) ? "hex" : "binary", (int)token_len, token);
+				errors++;
+
+				// skips the rest of the line with the bad word
+				pos = (newline == NULL) ? input.size : (size_t)(newline - input.data) + 1;
+				line_num += (newline != NULL);
+				counted = pos;
+			}
+		}
+	}
+
+	unmapInput(&input);
+	if (closeOutput(&output) != 0) {
+		fprintf(stderr, "ERROR: Could not write the output for %s\n", name);
+		errors++;
+	}
+
+	return errors;
+}
+
+/*----------------------------\
+		  Buffered I/O
+\----------------------------*/
+/*
+	Purpose: reads the rest of a file into the heap, for inputs that can't be mapped
+	Params: Mapped_Input* input - the input to fill
+			FILE* file - the file to read
+	Return: int - 0 for no error, 1 if the file couldn't be read
+*/
+static int readInput(Mapped_Input* input, FILE* file) {
+	size_t capacity = BATCH_BUFF_SIZE;
+	char* data = malloc(capacity);
+	size_t size = 0;
+	size_t got;
+
+	if (data == NULL) {
+		return 1;
+	}
+
+	// doubles the buffer whenever it fills up
+	while ((got = fread(data + size, 1, capacity - size, file)) > 0) {
+		size += got;
+
+		if (size == capacity) {
+			char* bigger = realloc(data, capacity * 2);
+			if (bigger == NULL) {
+				free(data);
+				return 1;
+			}
+
+			data = bigger;
+			capacity *= 2;
+		}
+	}
+
+	if (ferror(file)) {
+		free(data);
+		return 1;
+	}
+
+	input->data = data;
+	input->size = size;
+	return 0;
+}
+
+/*
+	Purpose: maps an open file into memory, files that can't be mapped (like pipes) are read into the heap
+	Params: Mapped_Input* input - the input to set up
+			FILE* file - the file to read, from its current position for pipes
+	Return: int - 0 for no error, 1 if the file couldn't be mapped or read
+*/
+int mapInput(Mapped_Input* input, FILE* file) {
+	input->data = NULL;
+	input->size = 0;
+	input->pos = 0;
+	input->released = 0;
+	input->mapped = 0;
+
+#ifndef _WIN32
+	struct stat info;
+	int fd = fileno(file);
+
+	// only regular files that haven't been read from yet can be mapped
+	if ((fstat(fd, &info) == 0) && S_ISREG(info.st_mode) && (ftell(file) == 0)) {
+		// an empty file can't be mapped, but doesn't need to be
+		if (info.st_size == 0) {
+			return 0;
+		}
+
+		void* data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data != MAP_FAILED) {
+			// the file is read front to back, so the system can read ahead aggressively
+			madvise(data, (size_t)info.st_size, MADV_SEQUENTIAL);
+
+			input->data = data;
+			input->size = (size_t)info.st_size;
+			input->mapped = 1;
+			return 0;
+		}
+	}
+#endif
+
+	return readInput(input, file);
+}
+
+/*
+	Purpose: tells the system the input has been read up to its current position, so mapped
+			 pages behind it can be dropped and memory use stays flat on huge files
+	Params: Mapped_Input* input - the input being read
+	Return: none
+*/
+void releaseInput(Mapped_Input* input) {
+#ifndef _WIN32
+	if (!input->mapped || (input->pos - input->released < MAP_RELEASE_SIZE)) {
+		return;
+	}
+
+	// only whole pages behind the current position can be dropped
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+	size_t release_end = input->pos & ~(page - 1);
+
+	madvise((void*)(input->data + input->released), release_end - input->released, MADV_DONTNEED);
+	input->released = release_end;
+#else
+	(void)input;
+#endif
+}
+
+/*
+	Purpose: unmaps or frees the contents of an input, the file is left open
+	Params: Mapped_Input* input - the input to close
+	Return: none
+*/
+void unmapInput(Mapped_Input* input) {
+#ifndef _WIN32
+	if (input->mapped) {
+		munmap((void*)input->data, input->size);
+	}
+	else
+#endif
+	{
+		free((void*)input->data);
+	}
+
+	input->data = NULL;
+	input->size = 0;
+}
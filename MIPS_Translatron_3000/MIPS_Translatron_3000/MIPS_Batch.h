@@ -0,0 +1,117 @@
+#ifndef _MIPS_BATCH_H_
+#define _MIPS_BATCH_H_
+
+#pragma warning(disable : 4996)
+
+#include <stdio.h>
+#include <stdint.h>
+#include "global_data.h"
+#include "MIPS_Format.h"
+
+// starting size of the buffer an input that can't be mapped is read into
+#define BATCH_BUFF_SIZE (1 << 20)
+
+// number of words converted at a time when disassembling text
+#define INGEST_BLOCK 4096
+
+// bytes of assembly each thread assembles at a time, rounded up to the end of a line
+#define ASSEMBLE_CHUNK_SIZE (1 << 20)
+
+// words of a raw image each thread disassembles at a time
+#define DISASSEMBLE_CHUNK_WORDS (1 << 14)
+
+// most characters one line of a listing takes, the address, the instruction and a newline
+#define LISTING_LINE_SIZE (FORMAT_SIZE + 32)
+
+// how far a mapped input is read past pages before they are given back to the system
+#define MAP_RELEASE_SIZE (16 << 20)
+
+/*----------------------------\
+		   Enums
+\----------------------------*/
+// formats the batch disassembler can read words from
+typedef enum Word_Format {
+	FORMAT_HEX,		// one hex word per line, as read by parseHex
+	FORMAT_BIN,		// one binary word per line, as read by parseBin
+	FORMAT_RAW_BE,	// raw big endian 32 bit words
+	FORMAT_RAW_LE	// raw little endian 32 bit words
+} Word_Format;
+
+
+/*----------------------------\
+		   Data Types
+\----------------------------*/
+// struct for reading a whole input file in place, lines are handed out as views into it
+typedef struct {
+	const char* data;	// the contents of the file, not terminated
+	size_t size;		// number of bytes in the file
+	size_t pos;			// first unread byte
+	size_t released;	// bytes before this have been given back to the system
+	int mapped;			// set if data is a memory map, otherwise it was read into the heap
+} Mapped_Input;
+
+
+/*----------------------------\
+		  Batch Mode
+\----------------------------*/
+/*
+	Purpose: runs batch mode from the command line arguments
+	Params: int argc - the number of arguments
+			char** argv - the arguments given to main
+	Return: int - the exit code for the program
+*/
+int runBatch(int argc, char** argv);
+
+/*
+	Purpose: assembles every line of a file into hex machine code, one word per line, the file is
+			 split into chunks of whole lines that threads assemble at once, the words and errors
+			 are still written in the order of the lines
+	Params: FILE* in - the assembly to read
+			FILE* out - where to write the machine code
+			const char* name - the input name used in error messages
+			uint32_t threads - the number of threads to assemble with, 1 to MAX_THREADS
+	Return: uint32_t - the number of lines that had errors
+*/
+uint32_t assembleFile(FILE* in, FILE* out, const char* name, uint32_t threads);
+
+/*
+	Purpose: disassembles every word of a file into an addressed assembly listing, raw images
+			 are split into ranges of words that threads disassemble at once, the listing is
+			 still written in the order of the words
+	Params: FILE* in - the machine code to read
+			FILE* out - where to write the listing
+			const char* name - the input name used in error messages
+			Word_Format format - how the words are stored in the input
+			uint32_t threads - the number of threads to disassemble raw images with, 1 to MAX_THREADS
+	Return: uint32_t - the number of words that couldn't be read
+*/
+uint32_t disassembleFile(FILE* in, FILE* out, const char* name, Word_Format format, uint32_t threads);
+
+
+/*----------------------------\
+		  Buffered I/O
+\----------------------------*/
+/*
+	Purpose: maps an open file into memory, files that can't be mapped (like pipes) are read into the heap
+	Params: Mapped_Input* input - the input to set up
+			FILE* file - the file to read, from its current position for pipes
+	Return: int - 0 for no error, 1 if the file couldn't be mapped or read
+*/
+int mapInput(Mapped_Input* input, FILE* file);
+
+/*
+	Purpose: tells the system the input has been read up to its current position, so mapped
+			 pages behind it can be dropped and memory use stays flat on huge files
+	Params: Mapped_Input* input - the input being read
+	Return: none
+*/
+void releaseInput(Mapped_Input* input);
+
+/*
+	Purpose: unmaps or frees the contents of an input, the file is left open
+	Params: Mapped_Input* input - the input to close
+	Return: none
+*/
+void unmapInput(Mapped_Input* input);
+
+#endif
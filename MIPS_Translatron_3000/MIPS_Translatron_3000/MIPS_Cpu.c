@@ -0,0 +1,93 @@
+#include "MIPS_Cpu.h"
+
+#include <stdatomic.h>
+
+#if defined(MIPS_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// set in the cached features once the processor has been checked
+#define CPU_CHECKED (1u << 31)
+
+// the features found by the first call to cpuFeatures, atomic since any thread can be first,
+// threads that race all find the same features so either store can win
+static _Atomic uint32_t cpu_features = 0;
+
+#if defined(MIPS_X86)
+/*
+	Purpose: runs the cpuid instruction
+	Params: uint32_t leaf - the leaf to query
+			uint32_t sub_leaf - the sub leaf to query
+			uint32_t regs[4] - filled with eax, ebx, ecx and edx
+	Return: none
+*/
+static void cpuid(uint32_t leaf, uint32_t sub_leaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuidex(info, (int)leaf, (int)sub_leaf);
+	for (int i = 0; i < 4; i++) { regs[i] = (uint32_t)info[i]; }
+#else
+	__cpuid_count(leaf, sub_leaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/*
+	Purpose: reads which register sets the OS saves on a context switch
+	Params: none
+	Return: uint64_t - the XCR0 register
+*/
+static uint64_t readXcr0(void) {
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	uint32_t lo, hi;
+	__asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	return ((uint64_t)hi << 32) | lo;
+#endif
+}
+#endif
+
+/*
+	Purpose: finds which vector instruction sets the processor running the program supports,
+			 the processor is only checked the first time
+	Params: none
+	Return: uint32_t - the CPU_ flags that are supported
+*/
+uint32_t cpuFeatures(void) {
+	uint32_t cached = atomic_load_explicit(&cpu_features, memory_order_relaxed);
+	if (cached & CPU_CHECKED) {
+		return cached & ~CPU_CHECKED;
+	}
+
+	uint32_t features = 0;
+
+#if defined(MIPS_X86)
+	uint32_t regs[4];
+
+	cpuid(0, 0, regs);
+	uint32_t max_leaf = regs[0];
+
+	cpuid(1, 0, regs);
+
+	// SSSE3 is ecx bit 9 and SSE4.1 is ecx bit 19
+	if ((regs[2] & (1u << 9)) && (regs[2] & (1u << 19))) {
+		features |= CPU_SSE41;
+	}
+
+	// AVX needs the OS to save the ymm registers, OSXSAVE is bit 27 and AVX is bit 28
+	if ((regs[2] & (1u << 27)) && (regs[2] & (1u << 28)) && ((readXcr0() & 0x6) == 0x6) && (max_leaf >= 7)) {
+		// AVX2 is ebx bit 5 of leaf 7
+		cpuid(7, 0, regs);
+		if (regs[1] & (1u << 5)) {
+			features |= CPU_AVX2;
+		}
+	}
+#endif
+
+	atomic_store_explicit(&cpu_features, features | CPU_CHECKED, memory_order_relaxed);
+	return features;
+}
@@ -0,0 +1,45 @@
+#ifndef _MIPS_CPU_H_
+#define _MIPS_CPU_H_
+
+#include <stdint.h>
+
+/*
+	MIPS_X86 is defined when building for an x86 processor, the only one the vector
+	paths are written for, building with MIPS_NO_SIMD leaves them out everywhere
+*/
+#if !defined(MIPS_NO_SIMD) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define MIPS_X86 1
+#endif
+
+// MIPS_LITTLE_ENDIAN is defined when words loaded from memory have their first byte lowest
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86) || defined(_WIN32) || \
+	(defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+#define MIPS_LITTLE_ENDIAN 1
+#endif
+
+/*
+	TARGET_SSE41 and TARGET_AVX2
+	mark a function as using that instruction set, so it can be built without
+	compiling the whole program for it and only called after checking cpuFeatures
+*/
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE41
+#define TARGET_AVX2
+#endif
+
+// instruction sets reported by cpuFeatures
+#define CPU_SSE41 (1u << 0)		// SSE4.1 along with SSSE3
+#define CPU_AVX2 (1u << 1)		// AVX2, including the OS saving the ymm registers
+
+/*
+	Purpose: finds which vector instruction sets the processor running the program supports,
+			 the processor is only checked the first time
+	Params: none
+	Return: uint32_t - the CPU_ flags that are supported
+*/
+uint32_t cpuFeatures(void);
+
+#endif
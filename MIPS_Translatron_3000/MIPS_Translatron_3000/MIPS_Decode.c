@@ -0,0 +1,201 @@
+#include "MIPS_Decode.h"
+#include "MIPS_Instruction.h"
+#include "MIPS_Cpu.h"
+
+#if defined(MIPS_X86)
+#include <immintrin.h>
+#endif
+
+// a kernel decodes as many whole blocks of words as it can, returning how many it did
+typedef size_t (*Decode_Kernel)(const uint32_t* words, size_t count, Decoded_Fields* out);
+
+/*----------------------------\
+		 Decode Tables
+\----------------------------*/
+/*
+	Op_Id + 1 of each opcode in entries 0 to 63 and of each SPECIAL function code in entries
+	64 to 127, 0 for anything that isn't an instruction, kept as 32 bit entries so AVX2 can gather from it
+*/
+static const int32_t decode_slots[128] = {
+#define ISA_DECODE_SLOT(name, spelling, format, opcode, funct, ...) [DECODE_INDEX(format, opcode, funct)] = OP_##name + 1,
+	ISA_TABLE(ISA_DECODE_SLOT)
+#undef ISA_DECODE_SLOT
+};
+
+// fixed bits of each slot, the same patterns decode checks, slot 0 has a match nothing can have
+static const int32_t decode_masks[OP_COUNT + 1] = {
+	[0] = 0,
+#define ISA_DECODE_MASK(name, spelling, format, opcode, funct, zeros, ...) [OP_##name + 1] = (int32_t)ISA_PATTERN_MASK(format, zeros),
+	ISA_TABLE(ISA_DECODE_MASK)
+#undef ISA_DECODE_MASK
+};
+static const int32_t decode_matches[OP_COUNT + 1] = {
+	[0] = 1,
+#define ISA_DECODE_MATCH(name, spelling, format, opcode, funct, ...) [OP_##name + 1] = (int32_t)ISA_PATTERN_MATCH(opcode, funct),
+	ISA_TABLE(ISA_DECODE_MATCH)
+#undef ISA_DECODE_MATCH
+};
+
+
+/*----------------------------\
+		Scalar Decoding
+\----------------------------*/
+/*
+	Purpose: splits one word into its fields and finds which instruction it is
+	Params: uint32_t word - the word to decode
+			size_t i - the entry to fill in each array
+			Decoded_Fields* out - the arrays to fill
+	Return: none
+*/
+static inline void decodeOne(uint32_t word, size_t i, Decoded_Fields* out) {
+	uint32_t opcode = field_opcode(word);
+	uint32_t funct = field_funct(word);
+	int32_t slot = decode_slots[(opcode == 0) ? 64 + funct : opcode];
+
+	// the index only narrows it down to one instruction, the rest of its fixed bits still have to match
+	out->id[i] = (((int32_t)word & decode_masks[slot]) == decode_matches[slot]) ? (uint8_t)(slot - 1) : (uint8_t)OP_NONE;
+	out->opcode[i] = (uint8_t)opcode;
+	out->rs[i] = (uint8_t)field_rs(word);
+	out->rt[i] = (uint8_t)field_rt(word);
+	out->rd[i] = (uint8_t)field_rd(word);
+	out->shamt[i] = (uint8_t)field_shamt(word);
+	out->funct[i] = (uint8_t)funct;
+	out->imm[i] = (uint16_t)field_imm16(word);
+}
+
+
+/*----------------------------\
+		Vector Decoding
+\----------------------------*/
+#if defined(MIPS_X86)
+/*
+	Purpose: narrows 16 fields of 32 bits down to bytes and stores them in order
+	Params: uint8_t* dst - where to store the 16 bytes
+			__m256i first - the fields of words 0 to 7
+			__m256i second - the fields of words 8 to 15
+	Return: none
+*/
+TARGET_AVX2
+static inline void storeBytes16(uint8_t* dst, __m256i first, __m256i second) {
+	// the packs work within lanes, so the 4 byte groups come out as words 0-3, 8-11 in the low
+	// lane and 4-7, 12-15 in the high lane, the permute puts them back in order
+	__m256i halves = _mm256_packus_epi32(first, second);
+	__m256i bytes = _mm256_packus_epi16(halves, _mm256_setzero_si256());
+	bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+
+	_mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(bytes));
+}
+
+/*
+	Purpose: narrows 16 fields of 32 bits down to 16 bits and stores them in order
+	Params: uint16_t* dst - where to store the 16 values
+			__m256i first - the fields of words 0 to 7
+			__m256i second - the fields of words 8 to 15
+	Return: none
+*/
+TARGET_AVX2
+static inline void storeHalves16(uint16_t* dst, __m256i first, __m256i second) {
+	__m256i halves = _mm256_permute4x64_epi64(_mm256_packus_epi32(first, second), 0xD8);
+
+	_mm256_storeu_si256((__m256i*)dst, halves);
+}
+
+/*
+	Purpose: finds which instruction each of 8 words is
+	Params: __m256i words - the words
+			__m256i opcode - their opcodes
+			__m256i funct - their function codes
+	Return: __m256i - the Op_Id of each word
+*/
+TARGET_AVX2
+static inline __m256i classify8(__m256i words, __m256i opcode, __m256i funct) {
+	// SPECIAL words look up their function code in the second half of the table
+	__m256i special = _mm256_cmpeq_epi32(opcode, _mm256_setzero_si256());
+	__m256i index = _mm256_add_epi32(opcode, _mm256_and_si256(special, _mm256_add_epi32(funct, _mm256_set1_epi32(64))));
+	__m256i slot = _mm256_i32gather_epi32((const int*)decode_slots, index, 4);
+
+	// then the rest of the fixed bits of that instruction have to match
+	__m256i mask = _mm256_i32gather_epi32((const int*)decode_masks, slot, 4);
+	__m256i match = _mm256_i32gather_epi32((const int*)decode_matches, slot, 4);
+	__m256i matched = _mm256_cmpeq_epi32(_mm256_and_si256(words, mask), match);
+	__m256i id = _mm256_sub_epi32(slot, _mm256_set1_epi32(1));
+
+	return _mm256_blendv_epi8(_mm256_set1_epi32(OP_NONE), id, matched);
+}
+
+/*
+	Purpose: decodes words 16 at a time with AVX2
+	Params: const uint32_t* words - the words to decode
+			size_t count - the number of words
+			Decoded_Fields* out - the arrays to fill
+	Return: size_t - the number of words decoded, a multiple of 16
+*/
+TARGET_AVX2
+static size_t decodeKernelAvx2(const uint32_t* words, size_t count, Decoded_Fields* out) {
+	const __m256i five_bits = _mm256_set1_epi32(0x1F);
+	const __m256i six_bits = _mm256_set1_epi32(0x3F);
+	const __m256i sixteen_bits = _mm256_set1_epi32(0xFFFF);
+
+	size_t i = 0;
+
+	for (; i + 16 <= count; i += 16) {
+		__m256i first = _mm256_loadu_si256((const __m256i*)(words + i));
+		__m256i second = _mm256_loadu_si256((const __m256i*)(words + i + 8));
+
+		__m256i opcode_0 = _mm256_srli_epi32(first, 26);
+		__m256i opcode_1 = _mm256_srli_epi32(second, 26);
+		__m256i funct_0 = _mm256_and_si256(first, six_bits);
+		__m256i funct_1 = _mm256_and_si256(second, six_bits);
+
+		storeBytes16(out->id + i, classify8(first, opcode_0, funct_0), classify8(second, opcode_1, funct_1));
+		storeBytes16(out->opcode + i, opcode_0, opcode_1);
+		storeBytes16(out->rs + i, _mm256_and_si256(_mm256_srli_epi32(first, 21), five_bits), _mm256_and_si256(_mm256_srli_epi32(second, 21), five_bits));
+		storeBytes16(out->rt + i, _mm256_and_si256(_mm256_srli_epi32(first, 16), five_bits), _mm256_and_si256(_mm256_srli_epi32(second, 16), five_bits));
+		storeBytes16(out->rd + i, _mm256_and_si256(_mm256_srli_epi32(first, 11), five_bits), _mm256_and_si256(_mm256_srli_epi32(second, 11), five_bits));
+		storeBytes16(out->shamt + i, _mm256_and_si256(_mm256_srli_epi32(first, 6), five_bits), _mm256_and_si256(_mm256_srli_epi32(second, 6), five_bits));
+		storeBytes16(out->funct + i, funct_0, funct_1);
+		storeHalves16(out->imm + i, _mm256_and_si256(first, sixteen_bits), _mm256_and_si256(second, sixteen_bits));
+	}
+
+	return i;
+}
+#endif
+
+/*
+	Purpose: picks the fastest kernel the processor supports, nothing is cached here so any
+			 thread can call it, cpuFeatures only checks the processor once
+	Params: none
+	Return: Decode_Kernel - the kernel, or NULL if only the scalar path can be used
+*/
+static Decode_Kernel decodeKernel(void) {
+#if defined(MIPS_X86)
+	if (cpuFeatures() & CPU_AVX2) {
+		return decodeKernelAvx2;
+	}
+#endif
+
+	return NULL;
+}
+
+
+/*----------------------------\
+		  Bulk Decoding
+\----------------------------*/
+/*
+	Purpose: splits every word into its fields and finds which instruction each one is,
+			 the same one decode would pick, 16 words are done at a time with AVX2 when the
+			 processor has it
+	Params: const uint32_t* words - the words to decode
+			size_t count - the number of words
+			Decoded_Fields* out - the arrays to fill, each needs room for count entries
+	Return: none
+*/
+void decodeMany(const uint32_t* words, size_t count, Decoded_Fields* out) {
+	Decode_Kernel kernel = decodeKernel();
+	size_t i = (kernel != NULL) ? kernel(words, count, out) : 0;
+
+	// whatever doesn't fill a whole block is done one word at a time
+	for (; i < count; i++) {
+		decodeOne(words[i], i, out);
+	}
+}
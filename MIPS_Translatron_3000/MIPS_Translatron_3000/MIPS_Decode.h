@@ -0,0 +1,40 @@
+#ifndef _MIPS_DECODE_H_
+#define _MIPS_DECODE_H_
+
+#pragma warning(disable : 4996)
+
+#include <stdint.h>
+#include <stddef.h>
+#include "global_data.h"
+
+/*----------------------------\
+		   Data Types
+\----------------------------*/
+// fields split out of a run of words, one caller supplied array per field with room for every word
+typedef struct {
+	uint8_t* id;		// Op_Id of each word, OP_NONE for words that aren't a known instruction
+	uint8_t* opcode;	// bits 31 to 26
+	uint8_t* rs;		// bits 25 to 21
+	uint8_t* rt;		// bits 20 to 16
+	uint8_t* rd;		// bits 15 to 11
+	uint8_t* shamt;		// bits 10 to 6
+	uint8_t* funct;		// bits 5 to 0
+	uint16_t* imm;		// bits 15 to 0
+} Decoded_Fields;
+
+
+/*----------------------------\
+		  Bulk Decoding
+\----------------------------*/
+/*
+	Purpose: splits every word into its fields and finds which instruction each one is,
+			 the same one decode would pick, 16 words are done at a time with AVX2 when the
+			 processor has it
+	Params: const uint32_t* words - the words to decode
+			size_t count - the number of words
+			Decoded_Fields* out - the arrays to fill, each needs room for count entries
+	Return: none
+*/
+void decodeMany(const uint32_t* words, size_t count, Decoded_Fields* out);
+
+#endif
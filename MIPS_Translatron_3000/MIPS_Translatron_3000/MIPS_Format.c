@@ -0,0 +1,230 @@
+#include "MIPS_Format.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+/*----------------------------\
+		 Lookup Tables
+\----------------------------*/
+// uppercase hex digit of each nibble
+const char hex_digits[16] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
+
+// the 4 binary digits of each nibble, most significant bit first
+const char nibble_bits[16][4] = {
+	{ '0', '0', '0', '0' }, { '0', '0', '0', '1' }, { '0', '0', '1', '0' }, { '0', '0', '1', '1' },
+	{ '0', '1', '0', '0' }, { '0', '1', '0', '1' }, { '0', '1', '1', '0' }, { '0', '1', '1', '1' },
+	{ '1', '0', '0', '0' }, { '1', '0', '0', '1' }, { '1', '0', '1', '0' }, { '1', '0', '1', '1' },
+	{ '1', '1', '0', '0' }, { '1', '1', '0', '1' }, { '1', '1', '1', '0' }, { '1', '1', '1', '1' }
+};
+
+// name printed for each register number, the same names lexReg reads
+const char* const reg_names[32] = {
+	"$zero", "$at", "$v0", "$v1", "$a0", "$a1", "$a2", "$a3",
+	"$t0", "$t1", "$t2", "$t3", "$t4", "$t5", "$t6", "$t7",
+	"$s0", "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7",
+	"$t8", "$t9", "$k0", "$k1", "$gp", "$sp", "$fp", "$ra"
+};
+
+// length of each name in reg_names
+const uint8_t reg_name_lens[32] = {
+	5, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3
+};
+
+
+/*----------------------------\
+		  Formatting
+\----------------------------*/
+/*
+	Purpose: writes a number in uppercase hex without leading zeros, like %X
+	Params: char* buff - where to write
+			uint32_t value - the number to write
+	Return: char* - the position after the digits
+*/
+char* appendHex(char* buff, uint32_t value) {
+	// counts the digits, zero still gets one
+	int digits = 1;
+	while ((digits < 8) && ((value >> (4 * digits)) != 0)) { digits++; }
+
+	// fills the digits in from the least significant end
+	for (int i = digits - 1; i >= 0; i--) {
+		buff[i] = hex_digits[value & 0xF];
+		value >>= 4;
+	}
+
+	return buff + digits;
+}
+
+
+/*----------------------------\
+		  Buffered I/O
+\----------------------------*/
+/*
+	Purpose: sets up an output buffer on an open file
+	Params: Out_Buffer* out - the buffer to set up
+			FILE* file - the file to write to
+	Return: int - 0 for no error, 1 if the buffer couldn't be allocated
+*/
+int openOutput(Out_Buffer* out, FILE* file) {
+	out->file = file;
+	out->len = 0;
+	out->failed = 0;
+	out->data = malloc(OUT_BUFF_SIZE);
+
+	return (out->data == NULL) ? 1 : 0;
+}
+
+/*
+	Purpose: writes everything in the output buffer to its file
+	Params: Out_Buffer* out - the buffer to flush
+	Return: none
+*/
+static void flushOutput(Out_Buffer* out) {
+	if ((out->len > 0) && (fwrite(out->data, 1, out->len, out->file) != out->len)) {
+		out->failed = 1;
+	}
+
+	out->len = 0;
+}
+
+/*
+	Purpose: adds bytes to the output buffer, writing the buffer out when it is full
+	Params: Out_Buffer* out - the buffer to add to
+			const char* str - the bytes to add
+			size_t len - the number of bytes
+	Return: none
+*/
+void writeOutput(Out_Buffer* out, const char* str, size_t len) {
+	// a chunk with no words may not have an output yet, so str can be NULL
+	if (len == 0) {
+		return;
+	}
+
+	if (out->len + len > OUT_BUFF_SIZE) {
+		flushOutput(out);
+
+		// anything bigger than the buffer goes straight to the file
+		if (len > OUT_BUFF_SIZE) {
+			if (fwrite(str, 1, len, out->file) != len) {
+				out->failed = 1;
+			}
+			return;
+		}
+	}
+
+	memcpy(out->data + out->len, str, len);
+	out->len += len;
+}
+
+/*
+	Purpose: writes several separately formatted parts to the file in order, after anything
+			 already in the buffer, with a single gathered write where the system has one
+	Params: Out_Buffer* out - the buffer to write through
+			char* const* parts - the parts to write
+			const size_t* lens - the number of bytes in each part
+			uint32_t count - the number of parts
+	Return: none
+*/
+void writeOutputParts(Out_Buffer* out, char* const* parts, const size_t* lens, uint32_t count) {
+#ifndef _WIN32
+	struct iovec iov[OUT_PARTS_MAX];
+
+	// everything buffered by stdio has to reach the file before the parts do
+	flushOutput(out);
+	if (fflush(out->file) != 0) {
+		out->failed = 1;
+	}
+
+	while (count > 0) {
+		uint32_t group = (count > OUT_PARTS_MAX) ? OUT_PARTS_MAX : count;
+		uint32_t first = 0;
+
+		for (uint32_t i = 0; i < group; i++) {
+			iov[i].iov_base = parts[i];
+			iov[i].iov_len = lens[i];
+		}
+
+		// the system may write less than asked, so the rest is written until the group is done
+		while (first < group) {
+			ssize_t written = writev(fileno(out->file), iov + first, (int)(group - first));
+
+			if (written < 0) {
+				// a signal that lands before anything is written isn't a failure, the write is tried again
+				if (errno == EINTR) {
+					continue;
+				}
+
+				out->failed = 1;
+				return;
+			}
+
+			while ((first < group) && ((size_t)written >= iov[first].iov_len)) {
+				written -= (ssize_t)iov[first].iov_len;
+				first++;
+			}
+			if (first < group) {
+				iov[first].iov_base = (char*)iov[first].iov_base + written;
+				iov[first].iov_len -= (size_t)written;
+			}
+		}
+
+		parts += group;
+		lens += group;
+		count -= group;
+	}
+#else
+	// without a gathered write the parts just go through the buffer
+	for (uint32_t i = 0; i < count; i++) {
+		writeOutput(out, parts[i], lens[i]);
+	}
+#endif
+}
+
+/*
+	Purpose: gets room at the end of the output buffer to format into directly,
+			 writing the buffer out first if there isn't enough room
+	Params: Out_Buffer* out - the buffer to add to
+			size_t len - the most bytes that will be written
+	Return: char* - where to write, pass the end to commitOutput when done
+*/
+char* reserveOutput(Out_Buffer* out, size_t len) {
+	if (out->len + len > OUT_BUFF_SIZE) {
+		flushOutput(out);
+	}
+
+	return out->data + out->len;
+}
+
+/*
+	Purpose: adds the bytes formatted into reserved room to the output buffer
+	Params: Out_Buffer* out - the buffer that was reserved from
+			const char* end - the position after the last byte written
+	Return: none
+*/
+void commitOutput(Out_Buffer* out, const char* end) {
+	out->len = (size_t)(end - out->data);
+}
+
+/*
+	Purpose: writes out anything left in the buffer and frees it, the file is left open
+	Params: Out_Buffer* out - the buffer to close
+	Return: int - 0 for no error, 1 if any write failed
+*/
+int closeOutput(Out_Buffer* out) {
+	flushOutput(out);
+	free(out->data);
+	out->data = NULL;
+
+	if (fflush(out->file) != 0) {
+		out->failed = 1;
+	}
+
+	return out->failed;
+}
@@ -0,0 +1,181 @@
+#ifndef _MIPS_FORMAT_H_
+#define _MIPS_FORMAT_H_
+
+#pragma warning(disable : 4996)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "global_data.h"
+
+// size of the buffer output is collected in before it is written
+#define OUT_BUFF_SIZE (1 << 20)
+
+// most parts writeOutputParts hands to the system in one call
+#define OUT_PARTS_MAX 64
+
+// number of characters appendBinary32 writes, 8 groups of 4 bits each followed by a space
+#define BINARY32_SIZE 40
+
+/*----------------------------\
+		 Lookup Tables
+\----------------------------*/
+// uppercase hex digit of each nibble
+extern const char hex_digits[16];
+
+// the 4 binary digits of each nibble, most significant bit first
+extern const char nibble_bits[16][4];
+
+// name printed for each register number, the same names lexReg reads
+extern const char* const reg_names[32];
+
+// length of each name in reg_names
+extern const uint8_t reg_name_lens[32];
+
+
+/*----------------------------\
+		   Data Types
+\----------------------------*/
+// struct for collecting output into a large buffer before writing it
+typedef struct {
+	FILE* file;
+	char* data;		// OUT_BUFF_SIZE bytes
+	size_t len;		// number of bytes waiting to be written
+	int failed;		// set if a write to the file failed
+} Out_Buffer;
+
+
+/*----------------------------\
+		  Formatting
+\----------------------------*/
+/*
+	Purpose: copies a string into a buffer
+	Params: char* buff - where to write
+			const char* str - the string to copy
+			size_t len - the number of characters to copy
+	Return: char* - the position after the string
+*/
+static inline char* appendStr(char* buff, const char* str, size_t len) {
+	memcpy(buff, str, len);
+	return buff + len;
+}
+
+/*
+	Purpose: writes a word as exactly 8 uppercase hex digits, like %08X
+	Params: char* buff - where to write
+			uint32_t value - the word to write
+	Return: char* - the position after the digits
+*/
+static inline char* appendHex32(char* buff, uint32_t value) {
+	for (int i = 0; i < 8; i++) {
+		buff[i] = hex_digits[(value >> (28 - (4 * i))) & 0xF];
+	}
+
+	return buff + 8;
+}
+
+/*
+	Purpose: writes a word as 32 binary digits, each group of 4 followed by a space like printMachine
+	Params: char* buff - where to write, at least BINARY32_SIZE characters
+			uint32_t value - the word to write
+	Return: char* - the position after the last space
+*/
+static inline char* appendBinary32(char* buff, uint32_t value) {
+	for (int i = 0; i < 8; i++) {
+		memcpy(buff + (5 * i), nibble_bits[(value >> (28 - (4 * i))) & 0xF], 4);
+		buff[(5 * i) + 4] = ' ';
+	}
+
+	return buff + BINARY32_SIZE;
+}
+
+/*
+	Purpose: writes the name of a register, numbers past 31 write nothing
+	Params: char* buff - where to write
+			uint32_t reg - the register number
+	Return: char* - the position after the name
+*/
+static inline char* appendReg(char* buff, uint32_t reg) {
+	if (reg >= 32) {
+		return buff;
+	}
+
+	return appendStr(buff, reg_names[reg], reg_name_lens[reg]);
+}
+
+/*
+	Purpose: writes a number in uppercase hex without leading zeros, like %X
+	Params: char* buff - where to write
+			uint32_t value - the number to write
+	Return: char* - the position after the digits
+*/
+char* appendHex(char* buff, uint32_t value);
+
+/*
+	Purpose: writes an immediate parameter the way it is printed, like #0x1F
+	Params: char* buff - where to write
+			uint32_t value - the immediate
+	Return: char* - the position after the digits
+*/
+static inline char* appendImm(char* buff, uint32_t value) {
+	return appendHex(appendStr(buff, "#0x", 3), value);
+}
+
+
+/*----------------------------\
+		  Buffered I/O
+\----------------------------*/
+/*
+	Purpose: sets up an output buffer on an open file
+	Params: Out_Buffer* out - the buffer to set up
+			FILE* file - the file to write to
+	Return: int - 0 for no error, 1 if the buffer couldn't be allocated
+*/
+int openOutput(Out_Buffer* out, FILE* file);
+
+/*
+	Purpose: adds bytes to the output buffer, writing the buffer out when it is full
+	Params: Out_Buffer* out - the buffer to add to
+			const char* str - the bytes to add
+			size_t len - the number of bytes
+	Return: none
+*/
+void writeOutput(Out_Buffer* out, const char* str, size_t len);
+
+/*
+	Purpose: writes several separately formatted parts to the file in order, after anything
+			 already in the buffer, with a single gathered write where the system has one
+	Params: Out_Buffer* out - the buffer to write through
+			char* const* parts - the parts to write
+			const size_t* lens - the number of bytes in each part
+			uint32_t count - the number of parts
+	Return: none
+*/
+void writeOutputParts(Out_Buffer* out, char* const* parts, const size_t* lens, uint32_t count);
+
+/*
+	Purpose: gets room at the end of the output buffer to format into directly,
+			 writing the buffer out first if there isn't enough room
+	Params: Out_Buffer* out - the buffer to add to
+			size_t len - the most bytes that will be written
+	Return: char* - where to write, pass the end to commitOutput when done
+*/
+char* reserveOutput(Out_Buffer* out, size_t len);
+
+/*
+	Purpose: adds the bytes formatted into reserved room to the output buffer
+	Params: Out_Buffer* out - the buffer that was reserved from
+			const char* end - the position after the last byte written
+	Return: none
+*/
+void commitOutput(Out_Buffer* out, const char* end);
+
+/*
+	Purpose: writes out anything left in the buffer and frees it, the file is left open
+	Params: Out_Buffer* out - the buffer to close
+	Return: int - 0 for no error, 1 if any write failed
+*/
+int closeOutput(Out_Buffer* out);
+
+#endif
@@ -0,0 +1,612 @@
+#include "MIPS_Ingest.h"
+#include "MIPS_Cpu.h"
+#include "MIPS_Lex.h"
+#include <string.h>
+
+#if defined(MIPS_X86)
+#include <immintrin.h>
+#endif
+
+// a kernel converts as many words as it can in its fast format from pos, moving pos past them
+typedef size_t (*Ingest_Kernel)(const char* data, size_t len, size_t* pos, uint32_t* words, size_t max_words);
+
+/*----------------------------\
+		 Scalar Parsing
+\----------------------------*/
+/*
+	Purpose: checks if a character separates words
+	Params: char c - the character to check
+	Return: int - nonzero for whitespace, 0 for anything else
+*/
+static inline int isSpace(char c) {
+	return charIs(c, CHAR_BLANK | CHAR_NEWLINE);
+}
+
+/*
+	Purpose: parses one hex word, 1 to 8 digits with an optional 0x prefix and followed by whitespace
+	Params: const char* data - the text being parsed
+			size_t len - the number of characters in the text
+			size_t* pos - the start of the word, moved past it if it is valid
+			uint32_t* word - filled with the word
+	Return: int - 1 if the word was valid, 0 if it wasn't
+*/
+static int parseHexToken(const char* data, size_t len, size_t* pos, uint32_t* word) {
+	size_t p = *pos;
+
+	// skips the optional hex prefix
+	if ((len - p >= 2) && (data[p] == '0') && ((data[p + 1] | 0x20) == 'x')) {
+		p += 2;
+	}
+
+	size_t start = p;
+	uint32_t value = 0;
+
+	while ((p < len) && hex_values[(uint8_t)data[p]]) {
+		value = (value << 4) | (uint32_t)(hex_values[(uint8_t)data[p]] - 1);
+		p++;
+	}
+
+	// only whitespace can follow the word
+	if ((p == start) || (p - start > 8) || ((p < len) && !isSpace(data[p]))) {
+		return 0;
+	}
+
+	*word = value;
+	*pos = p;
+	return 1;
+}
+
+/*
+	Purpose: finds the distance between evenly spaced 8 digit words, one separator or a CRLF
+	Params: const char* word - the first word, at least 10 characters have to be readable
+	Return: size_t - 9 or 10, or 0 if the word isn't followed by whitespace
+*/
+static inline size_t wordStride(const char* word) {
+	if (!isSpace(word[8])) {
+		return 0;
+	}
+
+	return isSpace(word[9]) ? 10 : 9;
+}
+
+/*
+	Purpose: checks that the word at a position is followed by the same separator as the first word
+	Params: const char* word - the word to check
+			size_t stride - the stride found by wordStride
+	Return: int - 1 if the separator matches, 0 if it doesn't
+*/
+static inline int checkStride(const char* word, size_t stride) {
+	return isSpace(word[8]) && ((stride == 9) || isSpace(word[9]));
+}
+
+
+/*
+	Purpose: checks that only whitespace follows a word on its line
+	Params: const char* data - the text being parsed
+			size_t len - the number of characters in the text
+			size_t* pos - the position after the word, moved past the end of the line if it is valid
+	Return: int - 1 if the rest of the line is blank, 0 if it isn't
+*/
+static inline int endLine(const char* data, size_t len, size_t* pos) {
+	size_t p = *pos;
+
+	while ((p < len) && ((data[p] == ' ') || (data[p] == '\t') || (data[p] == '\r'))) { p++; }
+
+	if (p < len) {
+		if (data[p] != '\n') {
+			return 0;
+		}
+		p++;
+	}
+
+	*pos = p;
+	return 1;
+}
+
+/*
+	Purpose: parses one binary word, 1 to 32 digits with an optional 0b prefix, spaces can split
+			 up the digits and nothing but whitespace can follow them on the line
+	Params: const char* data - the text being parsed
+			size_t len - the number of characters in the text
+			size_t* pos - the start of the word, moved past the end of its line if it is valid
+			uint32_t* word - filled with the word
+	Return: int - 1 if the word was valid, 0 if it wasn't
+*/
+static int parseBinToken(const char* data, size_t len, size_t* pos, uint32_t* word) {
+	size_t p = *pos;
+
+	// skips the optional binary prefix
+	if ((len - p >= 2) && (data[p] == '0') && ((data[p + 1] | 0x20) == 'b')) {
+		p += 2;
+	}
+
+	uint32_t value = 0;
+	uint32_t digits = 0;
+
+	while (p < len) {
+#if defined(MIPS_LITTLE_ENDIAN)
+		// 8 digits in a row are checked together, then the multiply gathers the low bit of each
+		// byte into the top byte with the first digit highest
+		if (len - p >= 8) {
+			uint64_t chunk;
+			memcpy(&chunk, data + p, sizeof(chunk));
+
+			if ((chunk & 0xFEFEFEFEFEFEFEFEull) == 0x3030303030303030ull) {
+				value = (value << 8) | (uint32_t)(((chunk & 0x0101010101010101ull) * 0x8040201008040201ull) >> 56);
+				digits += 8;
+				p += 8;
+				continue;
+			}
+		}
+#endif
+		if ((data[p] == '0') || (data[p] == '1')) {
+			value = (value << 1) | (uint32_t)(data[p] - '0');
+			digits++;
+		}
+		else if (data[p] != ' ') {
+			break;
+		}
+		p++;
+	}
+
+	if ((digits == 0) || (digits > 32) || !endLine(data, len, &p)) {
+		return 0;
+	}
+
+	*word = value;
+	*pos = p;
+	return 1;
+}
+
+
+/*----------------------------\
+		 Vector Parsing
+\----------------------------*/
+#if defined(MIPS_X86)
+/*
+	Purpose: converts 2 words of 8 hex digits each at once
+	Params: __m128i text - the 16 digits, the first word in the low half
+			uint64_t* value - filled with the 2 words, the first in the low half
+	Return: int - 1 if every character was a hex digit, 0 if not
+*/
+TARGET_SSE41
+static inline int hexToWords128(__m128i text, uint64_t* value) {
+	// letters are compared in lower case, digits already have that bit set
+	__m128i lower = _mm_or_si128(text, _mm_set1_epi8(0x20));
+	__m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(text, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), text));
+	__m128i is_alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+
+	if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF) {
+		return 0;
+	}
+
+	// '0' to '9' become 0 to 9 and 'a' to 'f' become 49 to 54, then 39 is taken off the letters
+	__m128i nibbles = _mm_sub_epi8(_mm_sub_epi8(lower, _mm_set1_epi8('0')), _mm_and_si128(is_alpha, _mm_set1_epi8(39)));
+
+	// joins pairs of nibbles into bytes, then puts each word's bytes in little endian order
+	__m128i bytes = _mm_maddubs_epi16(nibbles, _mm_set1_epi16(0x0110));
+	__m128i words = _mm_shuffle_epi8(bytes, _mm_setr_epi8(6, 4, 2, 0, 14, 12, 10, 8, -1, -1, -1, -1, -1, -1, -1, -1));
+
+	_mm_storel_epi64((__m128i*)value, words);
+	return 1;
+}
+
+/*
+	Purpose: converts evenly spaced 8 digit words 2 at a time with SSE4.1
+	Params: const char* data - the text being parsed
+			size_t len - the number of characters in the text
+			size_t* pos - the start of the first word, moved past the words converted
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to convert
+	Return: size_t - the number of words converted
+*/
+TARGET_SSE41
+static size_t hexKernelSse41(const char* data, size_t len, size_t* pos, uint32_t* words, size_t max_words) {
+	size_t p = *pos;
+	size_t count = 0;
+
+	while ((count + 2 <= max_words) && (p + 10 <= len)) {
+		const char* word = data + p;
+		size_t stride = wordStride(word);
+
+		if ((stride == 0) || (p + (2 * stride) > len) || !checkStride(word + stride, stride)) {
+			break;
+		}
+
+		__m128i text = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)word), _mm_loadl_epi64((const __m128i*)(word + stride)));
+
+		uint64_t value;
+		if (!hexToWords128(text, &value)) {
+			break;
+		}
+
+		memcpy(words + count, &value, sizeof(value));
+		count += 2;
+		p += 2 * stride;
+	}
+
+	*pos = p;
+	return count;
+}
+
+/*
+	Purpose: converts evenly spaced 8 digit words 4 at a time with AVX2
+	Params: const char* data - the text being parsed
+			size_t len - the number of characters in the text
+			size_t* pos - the start of the first word, moved past the words converted
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to convert
+	Return: size_t - the number of words converted
+*/
+TARGET_AVX2
+static size_t hexKernelAvx2(const char* data, size_t len, size_t* pos, uint32_t* words, size_t max_words) {
+	size_t p = *pos;
+	size_t count = 0;
+
+	const __m256i low_bit = _mm256_set1_epi8(0x20);
+	const __m256i zero_below = _mm256_set1_epi8('0' - 1);
+	const __m256i nine_above = _mm256_set1_epi8('9' + 1);
+	const __m256i a_below = _mm256_set1_epi8('a' - 1);
+	const __m256i f_above = _mm256_set1_epi8('f' + 1);
+	const __m256i weights = _mm256_set1_epi16(0x0110);
+	const __m256i order = _mm256_setr_epi8(6, 4, 2, 0, 14, 12, 10, 8, -1, -1, -1, -1, -1, -1, -1, -1,
+										   6, 4, 2, 0, 14, 12, 10, 8, -1, -1, -1, -1, -1, -1, -1, -1);
+
+	while ((count + 4 <= max_words) && (p + 10 <= len)) {
+		const char* word = data + p;
+		size_t stride = wordStride(word);
+
+		if ((stride == 0) || (p + (4 * stride) > len) ||
+			!checkStride(word + stride, stride) || !checkStride(word + (2 * stride), stride) || !checkStride(word + (3 * stride), stride)) {
+			break;
+		}
+
+		// words 0 and 1 go in the low lane, 2 and 3 in the high lane
+		__m128i low = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)word), _mm_loadl_epi64((const __m128i*)(word + stride)));
+		__m128i high = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(word + (2 * stride))), _mm_loadl_epi64((const __m128i*)(word + (3 * stride))));
+		__m256i text = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+
+		// letters are compared in lower case, digits already have that bit set
+		__m256i lower = _mm256_or_si256(text, low_bit);
+		__m256i is_digit = _mm256_and_si256(_mm256_cmpgt_epi8(text, zero_below), _mm256_cmpgt_epi8(nine_above, text));
+		__m256i is_alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, a_below), _mm256_cmpgt_epi8(f_above, lower));
+
+		if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)) != -1) {
+			break;
+		}
+
+		// same conversion as hexToWords128, one lane at a time
+		__m256i nibbles = _mm256_sub_epi8(_mm256_sub_epi8(lower, _mm256_set1_epi8('0')), _mm256_and_si256(is_alpha, _mm256_set1_epi8(39)));
+		__m256i bytes = _mm256_shuffle_epi8(_mm256_maddubs_epi16(nibbles, weights), order);
+
+		// each lane holds 2 words in its low half, those are moved together
+		__m256i packed = _mm256_permute4x64_epi64(bytes, 0x08);
+		_mm_storeu_si128((__m128i*)(words + count), _mm256_castsi256_si128(packed));
+
+		count += 4;
+		p += 4 * stride;
+	}
+
+	// a pair can still be left before the next word that needs the scalar path
+	if (count + 2 <= max_words) {
+		count += hexKernelSse41(data, len, &p, words + count, max_words - count);
+	}
+
+	*pos = p;
+	return count;
+}
+
+/*
+	Purpose: packs 32 binary digits in a row at once
+	Params: const char* word - the digits, 32 characters have to be readable
+			uint32_t* value - filled with the word
+	Return: int - 1 if every character was a binary digit, 0 if not
+*/
+TARGET_SSE41
+static inline int binSolid128(const char* word, uint32_t* value) {
+	const __m128i low_bit = _mm_set1_epi8(1);
+	const __m128i ones = _mm_set1_epi8('1');
+	const __m128i reverse = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+	__m128i high = _mm_loadu_si128((const __m128i*)word);
+	__m128i low = _mm_loadu_si128((const __m128i*)(word + 16));
+
+	// '0' and '1' are the only characters that become '1' when the low bit is set
+	__m128i valid = _mm_and_si128(_mm_cmpeq_epi8(_mm_or_si128(high, low_bit), ones), _mm_cmpeq_epi8(_mm_or_si128(low, low_bit), ones));
+	if (_mm_movemask_epi8(valid) != 0xFFFF) {
+		return 0;
+	}
+
+	// moves each digit's low bit to the top of its byte, reversed so the first digit is the highest bit
+	uint32_t high_bits = (uint32_t)_mm_movemask_epi8(_mm_shuffle_epi8(_mm_slli_epi64(high, 7), reverse));
+	uint32_t low_bits = (uint32_t)_mm_movemask_epi8(_mm_shuffle_epi8(_mm_slli_epi64(low, 7), reverse));
+
+	*value = (high_bits << 16) | low_bits;
+	return 1;
+}
+
+/*
+	Purpose: packs 32 binary digits in groups of 4 split by single spaces, like printMachine writes them
+	Params: const char* word - the digits, 40 characters have to be readable
+			uint32_t* value - filled with the word
+	Return: int - 1 if the characters were in that format, 0 if not
+*/
+TARGET_SSE41
+static inline int binGrouped128(const char* word, uint32_t* value) {
+	// groups 0 to 2 and 3 to 5 are 15 characters each, 6 and 7 are read from character 24 so nothing past 40 is read
+	const __m128i group_bits = _mm_setr_epi8(1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0);
+	const __m128i group_chars = _mm_setr_epi8('1', '1', '1', '1', ' ', '1', '1', '1', '1', ' ', '1', '1', '1', '1', ' ', 0);
+	const __m128i tail_bits = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0);
+	const __m128i tail_chars = _mm_setr_epi8(0, 0, 0, 0, 0, 0, '1', '1', '1', '1', ' ', '1', '1', '1', '1', 0);
+
+	// gathers the digits, reversed so the first digit is the highest bit
+	const __m128i group_order = _mm_setr_epi8(-1, -1, -1, -1, 13, 12, 11, 10, 8, 7, 6, 5, 3, 2, 1, 0);
+	const __m128i tail_order = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 14, 13, 12, 11, 9, 8, 7, 6);
+
+	__m128i first = _mm_loadu_si128((const __m128i*)word);
+	__m128i second = _mm_loadu_si128((const __m128i*)(word + 15));
+	__m128i tail = _mm_loadu_si128((const __m128i*)(word + 24));
+
+	// digits become '1' when their low bit is set and spaces are left alone
+	int first_ok = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(first, group_bits), group_chars)) & 0x7FFF;
+	int second_ok = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(second, group_bits), group_chars)) & 0x7FFF;
+	int tail_ok = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(tail, tail_bits), tail_chars)) & 0x7FC0;
+
+	if ((first_ok != 0x7FFF) || (second_ok != 0x7FFF) || (tail_ok != 0x7FC0)) {
+		return 0;
+	}
+
+	uint32_t first_bits = (uint32_t)_mm_movemask_epi8(_mm_shuffle_epi8(_mm_slli_epi64(first, 7), group_order)) >> 4;
+	uint32_t second_bits = (uint32_t)_mm_movemask_epi8(_mm_shuffle_epi8(_mm_slli_epi64(second, 7), group_order)) >> 4;
+	uint32_t tail_bits_out = (uint32_t)_mm_movemask_epi8(_mm_shuffle_epi8(_mm_slli_epi64(tail, 7), tail_order)) >> 8;
+
+	*value = (first_bits << 20) | (second_bits << 8) | tail_bits_out;
+	return 1;
+}
+
+/*
+	Purpose: packs one binary word per line with SSE4.1, solid or grouped by 4
+	Params: const char* data - the text being parsed
+			size_t len - the number of characters in the text
+			size_t* pos - the start of the first word, moved past the lines converted
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to convert
+	Return: size_t - the number of words converted
+*/
+TARGET_SSE41
+static size_t binKernelSse41(const char* data, size_t len, size_t* pos, uint32_t* words, size_t max_words) {
+	size_t p = *pos;
+	size_t count = 0;
+
+	while (count < max_words) {
+		uint32_t value;
+		size_t end;
+
+		if ((p + 32 <= len) && binSolid128(data + p, &value)) {
+			end = p + 32;
+		}
+		else if ((p + 40 <= len) && binGrouped128(data + p, &value)) {
+			end = p + 39;
+		}
+		else {
+			break;
+		}
+
+		// anything else on the line is left for the scalar path to report
+		if (!endLine(data, len, &end)) {
+			break;
+		}
+
+		words[count++] = value;
+		p = end;
+	}
+
+	*pos = p;
+	return count;
+}
+
+/*
+	Purpose: packs one binary word per line with AVX2, solid or grouped by 4
+	Params: const char* data - the text being parsed
+			size_t len - the number of characters in the text
+			size_t* pos - the start of the first word, moved past the lines converted
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to convert
+	Return: size_t - the number of words converted
+*/
+TARGET_AVX2
+static size_t binKernelAvx2(const char* data, size_t len, size_t* pos, uint32_t* words, size_t max_words) {
+	size_t p = *pos;
+	size_t count = 0;
+
+	const __m256i low_bit = _mm256_set1_epi8(1);
+	const __m256i ones = _mm256_set1_epi8('1');
+	const __m256i reverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+											 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+	while (count < max_words) {
+		uint32_t value;
+		size_t end;
+
+		if (p + 32 <= len) {
+			__m256i text = _mm256_loadu_si256((const __m256i*)(data + p));
+
+			// all 32 digits are checked with one compare
+			if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_or_si256(text, low_bit), ones)) == -1) {
+				// reverses each lane and swaps them so the first digit ends up as the highest bit
+				__m256i bits = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(_mm256_slli_epi64(text, 7), reverse), 0x4E);
+				value = (uint32_t)_mm256_movemask_epi8(bits);
+				end = p + 32;
+			}
+			else if ((p + 40 <= len) && binGrouped128(data + p, &value)) {
+				end = p + 39;
+			}
+			else {
+				break;
+			}
+		}
+		else {
+			break;
+		}
+
+		// anything else on the line is left for the scalar path to report
+		if (!endLine(data, len, &end)) {
+			break;
+		}
+
+		words[count++] = value;
+		p = end;
+	}
+
+	*pos = p;
+	return count;
+}
+#endif
+
+/*
+	Purpose: picks the fastest hex kernel in a set of instruction sets, nothing is cached here so
+			 any thread can call it
+	Params: uint32_t features - the CPU_ flags the kernel can use
+	Return: Ingest_Kernel - the kernel, or NULL if only the scalar path can be used
+*/
+static Ingest_Kernel hexKernel(uint32_t features) {
+#if defined(MIPS_X86)
+	if (features & CPU_AVX2) {
+		return hexKernelAvx2;
+	}
+	if (features & CPU_SSE41) {
+		return hexKernelSse41;
+	}
+#endif
+
+	(void)features;
+	return NULL;
+}
+
+/*
+	Purpose: picks the fastest binary kernel in a set of instruction sets, nothing is cached here
+			 so any thread can call it
+	Params: uint32_t features - the CPU_ flags the kernel can use
+	Return: Ingest_Kernel - the kernel, or NULL if only the scalar path can be used
+*/
+static Ingest_Kernel binKernel(uint32_t features) {
+#if defined(MIPS_X86)
+	if (features & CPU_AVX2) {
+		return binKernelAvx2;
+	}
+	if (features & CPU_SSE41) {
+		return binKernelSse41;
+	}
+#endif
+
+	(void)features;
+	return NULL;
+}
+
+/*
+	Purpose: runs a kernel over the text and parses whatever it stops at one word at a time
+	Params: const char* data - the text to parse
+			size_t len - the number of characters in the text
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to parse
+			Ingest_Kernel kernel - the vector kernel, or NULL to only use the scalar path
+			int (*parseToken)(const char*, size_t, size_t*, uint32_t*) - the scalar parser for one word
+	Return: Ingest_Result - the number of words parsed and where parsing stopped
+*/
+static Ingest_Result ingestWords(const char* data, size_t len, uint32_t* words, size_t max_words,
+	Ingest_Kernel kernel, int (*parseToken)(const char*, size_t, size_t*, uint32_t*)) {
+	Ingest_Result result = { 0, 0, 0 };
+	size_t pos = 0;
+
+	while (1) {
+		// eat any whitespace
+		while ((pos < len) && isSpace(data[pos])) { pos++; }
+
+		if ((pos >= len) || (result.count >= max_words)) {
+			break;
+		}
+
+		// the vector kernel takes every word it can, the scalar path takes the one it stopped at
+		if (kernel != NULL) {
+			size_t converted = kernel(data, len, &pos, words + result.count, max_words - result.count);
+			result.count += converted;
+
+			if (converted > 0) {
+				continue;
+			}
+		}
+
+		if (!parseToken(data, len, &pos, &words[result.count])) {
+			result.malformed = 1;
+			break;
+		}
+
+		result.count++;
+	}
+
+	result.offset = pos;
+	return result;
+}
+
+
+/*----------------------------\
+		  Bulk Parsing
+\----------------------------*/
+/*
+	Purpose: parses whitespace separated hex words into an array, each word is 1 to 8 hex
+			 digits with an optional 0x prefix, runs of 8 digit words on evenly spaced lines
+			 are converted several at a time with SSE4.1 or AVX2 when the processor has them
+	Params: const char* data - the text to parse, does not need to be terminated
+			size_t len - the number of characters in the text
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to parse, parsing stops early when it is reached
+	Return: Ingest_Result - the number of words parsed and where parsing stopped
+*/
+Ingest_Result ingestHexWords(const char* data, size_t len, uint32_t* words, size_t max_words) {
+	return ingestHexWordsUsing(data, len, words, max_words, cpuFeatures());
+}
+
+/*
+	Purpose: parses hex words like ingestHexWords, only using the vector instruction sets it is
+			 given, so each path can be checked against the scalar one
+	Params: const char* data - the text to parse, does not need to be terminated
+			size_t len - the number of characters in the text
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to parse, parsing stops early when it is reached
+			uint32_t features - the CPU_ flags that can be used, 0 for only the scalar path, has to
+								be a subset of cpuFeatures
+	Return: Ingest_Result - the number of words parsed and where parsing stopped
+*/
+Ingest_Result ingestHexWordsUsing(const char* data, size_t len, uint32_t* words, size_t max_words, uint32_t features) {
+	return ingestWords(data, len, words, max_words, hexKernel(features), parseHexToken);
+}
+
+/*
+	Purpose: parses binary words into an array, one per line, each word is 1 to 32 binary digits
+			 with an optional 0b prefix that can be split up by spaces, like printMachine writes them,
+			 32 digit words written solid or in groups of 4 are checked and packed with SSE4.1 or AVX2
+			 when the processor has them
+	Params: const char* data - the text to parse, does not need to be terminated
+			size_t len - the number of characters in the text
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to parse, parsing stops early when it is reached
+	Return: Ingest_Result - the number of words parsed and where parsing stopped
+*/
+Ingest_Result ingestBinWords(const char* data, size_t len, uint32_t* words, size_t max_words) {
+	return ingestBinWordsUsing(data, len, words, max_words, cpuFeatures());
+}
+
+/*
+	Purpose: parses binary words like ingestBinWords, only using the vector instruction sets it
+			 is given, so each path can be checked against the scalar one
+	Params: const char* data - the text to parse, does not need to be terminated
+			size_t len - the number of characters in the text
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to parse, parsing stops early when it is reached
+			uint32_t features - the CPU_ flags that can be used, 0 for only the scalar path, has to
+								be a subset of cpuFeatures
+	Return: Ingest_Result - the number of words parsed and where parsing stopped
+*/
+Ingest_Result ingestBinWordsUsing(const char* data, size_t len, uint32_t* words, size_t max_words, uint32_t features) {
+	return ingestWords(data, len, words, max_words, binKernel(features), parseBinToken);
+}
@@ -0,0 +1,74 @@
+#ifndef _MIPS_INGEST_H_
+#define _MIPS_INGEST_H_
+
+#pragma warning(disable : 4996)
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*----------------------------\
+		   Data Types
+\----------------------------*/
+// what a bulk parse got through
+typedef struct {
+	size_t count;		// number of words written
+	size_t offset;		// bytes used, when malformed is set this is the start of the bad token
+	int malformed;		// set if parsing stopped at a token that isn't a word
+} Ingest_Result;
+
+
+/*----------------------------\
+		  Bulk Parsing
+\----------------------------*/
+/*
+	Purpose: parses whitespace separated hex words into an array, each word is 1 to 8 hex
+			 digits with an optional 0x prefix, runs of 8 digit words on evenly spaced lines
+			 are converted several at a time with SSE4.1 or AVX2 when the processor has them
+	Params: const char* data - the text to parse, does not need to be terminated
+			size_t len - the number of characters in the text
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to parse, parsing stops early when it is reached
+	Return: Ingest_Result - the number of words parsed and where parsing stopped
+*/
+Ingest_Result ingestHexWords(const char* data, size_t len, uint32_t* words, size_t max_words);
+
+/*
+	Purpose: parses hex words like ingestHexWords, only using the vector instruction sets it is
+			 given, so each path can be checked against the scalar one
+	Params: const char* data - the text to parse, does not need to be terminated
+			size_t len - the number of characters in the text
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to parse, parsing stops early when it is reached
+			uint32_t features - the CPU_ flags that can be used, 0 for only the scalar path, has to
+								be a subset of cpuFeatures
+	Return: Ingest_Result - the number of words parsed and where parsing stopped
+*/
+Ingest_Result ingestHexWordsUsing(const char* data, size_t len, uint32_t* words, size_t max_words, uint32_t features);
+
+/*
+	Purpose: parses binary words into an array, one per line, each word is 1 to 32 binary digits
+			 with an optional 0b prefix that can be split up by spaces, like printMachine writes them,
+			 32 digit words written solid or in groups of 4 are checked and packed with SSE4.1 or AVX2
+			 when the processor has them
+	Params: const char* data - the text to parse, does not need to be terminated
+			size_t len - the number of characters in the text
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to parse, parsing stops early when it is reached
+	Return: Ingest_Result - the number of words parsed and where parsing stopped
+*/
+Ingest_Result ingestBinWords(const char* data, size_t len, uint32_t* words, size_t max_words);
+
+/*
+	Purpose: parses binary words like ingestBinWords, only using the vector instruction sets it
+			 is given, so each path can be checked against the scalar one
+	Params: const char* data - the text to parse, does not need to be terminated
+			size_t len - the number of characters in the text
+			uint32_t* words - the array to fill
+			size_t max_words - the most words to parse, parsing stops early when it is reached
+			uint32_t features - the CPU_ flags that can be used, 0 for only the scalar path, has to
+								be a subset of cpuFeatures
+	Return: Ingest_Result - the number of words parsed and where parsing stopped
+*/
+Ingest_Result ingestBinWordsUsing(const char* data, size_t len, uint32_t* words, size_t max_words, uint32_t features);
+
+#endif
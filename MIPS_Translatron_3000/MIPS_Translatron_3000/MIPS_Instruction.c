@@ -1,91 +1,151 @@
 #include "MIPS_Instruction.h"
 
-Assm_Instruct assm_instruct;
-uint32_t instruct;
-uint16_t state;
+// context used by the functions that don't take one
+Translator_Ctx default_ctx;
 
 /*----------------------------\
-	   assembly_instructs
+	   Op Code Lookup
 \----------------------------*/
-// array containing all of the _assm functions
-void (*assembly_instructs[])(void) = {
-	// function names are placed below in a comma seperated list
-
-	// immediate instructions
-	addi_immd_assm,
-	andi_immd_assm,
-	ori_immd_assm,
-	lui_immd_assm,
-	lw_immd_assm,
-	beq_immd_assm,
-	bne_immd_assm,
-	slti_immd_assm,
-	sw_immd_assm,
-	
-	
-
-	// register functions
-	add_reg_assm,
-	sub_reg_assm,
-	mult_reg_assm,
-	div_reg_assm,
-	mfhi_reg_assm,
-	mflo_reg_assm,
-	and_reg_assm,
-	or_reg_assm,
-	slt_reg_assm,
-	
-	
-
-	end_list
+// mnemonic text for each Op_Id
+const char* const op_names[OP_COUNT] = {
+#define ISA_NAME(name, ...) [OP_##name] = #name,
+	ISA_TABLE(ISA_NAME)
+#undef ISA_NAME
+};
+
+// length of each mnemonic in op_names
+static const uint8_t op_name_lens[OP_COUNT] = {
+#define ISA_NAME_LEN(name, ...) [OP_##name] = sizeof(#name) - 1,
+	ISA_TABLE(ISA_NAME_LEN)
+#undef ISA_NAME_LEN
+};
+
+// how the parameters of each instruction are written, indexed by Op_Id
+const uint8_t op_syntax[OP_COUNT] = {
+#define ISA_SYNTAX(name, spelling, format, opcode, funct, zeros, syntax, ...) [OP_##name] = syntax,
+	ISA_TABLE(ISA_SYNTAX)
+#undef ISA_SYNTAX
+};
+
+// how the immediate of each instruction is read, indexed by Op_Id
+const uint8_t op_signs[OP_COUNT] = {
+#define ISA_SIGN(name, spelling, format, opcode, funct, zeros, syntax, sign, ...) [OP_##name] = sign,
+	ISA_TABLE(ISA_SIGN)
+#undef ISA_SIGN
+};
+
+// shortest and longest mnemonics, anything outside them can't be an instruction
+#define OP_NAME_MIN 2
+#define OP_NAME_MAX 4
+
+// perfect hash of an upper case mnemonic, collision free for every entry in ISA_TABLE
+#define OP_HASH_SIZE 32
+#define OP_HASH(first, second, last, len) ((((first) * 2) + ((second) * 9) + ((last) * 7) + (len)) & (OP_HASH_SIZE - 1))
+
+// OP_SPELL_HASH and OP_SPELL_LEN take the spelling column of ISA_TABLE, 2 to 4 characters
+#define OP_SPELL_PICK(a, b, c, d, picked, ...) picked
+#define OP_SPELL_HASH_2(a, b) OP_HASH(a, b, b, 2)
+#define OP_SPELL_HASH_3(a, b, c) OP_HASH(a, b, c, 3)
+#define OP_SPELL_HASH_4(a, b, c, d) OP_HASH(a, b, d, 4)
+#define OP_SPELL_HASH(...) OP_SPELL_PICK(__VA_ARGS__, OP_SPELL_HASH_4, OP_SPELL_HASH_3, OP_SPELL_HASH_2, 0)(__VA_ARGS__)
+#define OP_SPELL_LEN(...) OP_SPELL_PICK(__VA_ARGS__, 4, 3, 2, 0)
+
+// Op_Id + 1 for each hash slot, 0 for unused slots
+static const uint8_t op_hash_table[OP_HASH_SIZE] = {
+#define ISA_HASH(name, spelling, ...) [OP_SPELL_HASH spelling] = OP_##name + 1,
+	ISA_TABLE(ISA_HASH)
+#undef ISA_HASH
+};
+
+// every spelling matches the length of its mnemonic and fits the lookup
+#define ISA_SPELL_CHECK(name, spelling, ...) \
+	_Static_assert((OP_SPELL_LEN spelling == sizeof(#name) - 1) && (sizeof(#name) - 1 >= OP_NAME_MIN) && (sizeof(#name) - 1 <= OP_NAME_MAX), \
+		"the spelling of " #name " doesn't match its mnemonic");
+ISA_TABLE(ISA_SPELL_CHECK)
+#undef ISA_SPELL_CHECK
+
+// each mnemonic sets one bit of its slot, the bits only add up to the same as or-ing them if no two share a slot
+#define ISA_HASH_OR(name, spelling, ...) | (1ull << OP_SPELL_HASH spelling)
+#define ISA_HASH_SUM(name, spelling, ...) + (1ull << OP_SPELL_HASH spelling)
+_Static_assert((0 ISA_TABLE(ISA_HASH_OR)) == (0 ISA_TABLE(ISA_HASH_SUM)), "two mnemonics share a slot of op_hash_table, change OP_HASH");
+#undef ISA_HASH_OR
+#undef ISA_HASH_SUM
+
+
+/*----------------------------\
+		  encodings
+\----------------------------*/
+/*
+	REG_OPND(param, field) and IMM_OPND(param, field, max, error) build the struct Field of
+	one operand in ISA_TABLE, the index is converted to start at 0 for PARAM1
+*/
+#define REG_OPND(param, field) { FIELD_SHIFT_##field, FIELD_WIDTH_##field, (param) - 1, REGISTER, MISSING_REG, 31 }
+#define IMM_OPND(param, field, max, error) { FIELD_SHIFT_##field, FIELD_WIDTH_##field, (param) - 1, IMMEDIATE, error, max }
+
+// binary layout of each instruction indexed by Op_Id, base is the opcode and function code
+const struct Encoding encodings[OP_COUNT] = {
+#define ISA_ENCODING(name, spelling, format, opcode, funct, zeros, syntax, sign, ...) \
+	[OP_##name] = { ((uint32_t)(opcode) << 26) | (funct), { __VA_ARGS__ } },
+	ISA_TABLE(ISA_ENCODING)
+#undef ISA_ENCODING
 };
 
 
-// array containing all of the _bin functions for 32 bit instructions
-void (*binary_instructs[])(void) = {
-	// function names are placed below in a comma seperated list
-
-	// immediate instructions
-	addi_immd_bin,
-	andi_immd_bin,
-	ori_immd_bin,
-	lui_immd_bin,
-	lw_immd_bin,
-	beq_immd_bin,
-	bne_immd_bin,
-	slti_immd_bin,
-	sw_immd_bin,
-
-
-	// register functions
-	add_reg_bin,
-	sub_reg_bin,
-	mult_reg_bin,
-	div_reg_bin,
-	mfhi_reg_bin,
-	mflo_reg_bin,
-	and_reg_bin,
-	or_reg_bin,
-	slt_reg_bin,
-
-	end_list
+/*----------------------------\
+		  patterns
+\----------------------------*/
+// fixed bits of each instruction indexed by Op_Id, register functions also fix the function code
+const struct Bit_Pattern patterns[OP_COUNT] = {
+#define ISA_PATTERN(name, spelling, format, opcode, funct, zeros, syntax, sign, ...) \
+	[OP_##name] = { ISA_PATTERN_MASK(format, zeros), ISA_PATTERN_MATCH(opcode, funct) },
+	ISA_TABLE(ISA_PATTERN)
+#undef ISA_PATTERN
 };
 
 
+/*----------------------------\
+	     decode table
+\----------------------------*/
+// Op_Id + 1 for each primary opcode in entries 0 to 63 and each SPECIAL function code in 64 to 127
+static const uint8_t decode_table[128] = {
+#define ISA_DECODE(name, spelling, format, opcode, funct, ...) [DECODE_INDEX(format, opcode, funct)] = OP_##name + 1,
+	ISA_TABLE(ISA_DECODE)
+#undef ISA_DECODE
+};
+
 /*
-	Purpose: sets the global instrucion variables to the defualt values
-	Params: none
+	Purpose: finds which instruction a word encodes
+	Params: uint32_t word - the binary instruction
+	Return: Op_Id - the instruction, or OP_NONE if the word isn't a known instruction
+*/
+static inline Op_Id wordOp(uint32_t word) {
+	uint32_t opcode = field_opcode(word);
+	uint8_t slot = decode_table[(opcode == 0) ? 64 + field_funct(word) : opcode];
+
+	// the index only narrows it down to one instruction, the rest of its fixed bits still have to match
+	if ((slot == 0) || !matchPattern(word, patterns[slot - 1])) {
+		return OP_NONE;
+	}
+
+	return (Op_Id)(slot - 1);
+}
+
+
+/*
+	Purpose: sets the instrucion variables in the context to the defualt values
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void initInstructs(void) {
+void initInstructs_r(Translator_Ctx* ctx) {
 	// clears any errors
-	state = NO_ERROR;
+	STATE = NO_ERROR;
 
 	// sets the binary instruction to 0
 	BIN32 = 0x00;
 
 	// clears the op code
 	memset(OP_CODE, '\0', OP_SIZE + 1);
+	OP_ID = OP_NONE;
 
 	memset(COND, '\0', COND_SIZE + 1);
 
@@ -102,42 +162,114 @@ void initInstructs(void) {
 
 
 /*
-	Purpose: runs through each _assm function and tries to encode the parsed instruction
-	Params: none
+	Purpose: checks if a parameter value fits its field
+	Params: const struct Field* field - the field the value is packed into
+			uint32_t value - the value of the parameter
+			uint8_t sign - the Isa_Sign of the instruction
+	Return: int - 1 if the value fits, 0 if it doesn't
+*/
+static inline int inRange(const struct Field* field, uint32_t value, uint8_t sign) {
+	if (value <= field->max) {
+		return 1;
+	}
+
+	// negative values are two's complement, signed immediates take them down to the lowest the field holds
+	int32_t lowest = -(int32_t)(1u << (field->width - 1));
+	return ((sign == IMM_SIGNED) || (sign == IMM_BRANCH)) && (field->type == IMMEDIATE) && ((int32_t)value < 0) && ((int32_t)value >= lowest);
+}
+
+/*
+	Purpose: checks parameters against the encoding of an instruction and packs them
+	Params: Op_Id id - the instruction, must not be OP_NONE
+			const Param* params - the parameters to check
+			uint32_t* word - filled with the binary instruction if there wasn't an error
+	Return: uint16_t - COMPLETE_ENCODE, or the error with the parameters
+*/
+static uint16_t encodeParams(Op_Id id, const struct Param* params, uint32_t* word) {
+	const struct Encoding* enc = &encodings[id];
+
+	// validates the types of the parameters, in the order the table lists them
+	for (int i = 0; i < MAX_FIELDS; i++) {
+		const struct Field* field = &enc->fields[i];
+
+		if ((field->type != EMPTY) && (params[field->param].type != field->type)) {
+			return field->error;
+		}
+	}
+
+	// validates the values of the parameters
+	for (int i = 0; i < MAX_FIELDS; i++) {
+		const struct Field* field = &enc->fields[i];
+
+		if ((field->type != EMPTY) && !inRange(field, params[field->param].value, op_signs[id])) {
+			return (field->type == REGISTER) ? INVALID_REG : INVALID_IMMED;
+		}
+	}
+
+	// packs the fixed bits and the parameter fields into the binary instruction
+	*word = packFields(enc, params);
+	return COMPLETE_ENCODE;
+}
+
+/*
+	Purpose: checks the parameters against the encoding of the parsed op code and packs them
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void encode(void) {
+void encode_r(Translator_Ctx* ctx) {
 	// clears any errors
-	state = NO_ERROR;
+	STATE = NO_ERROR;
 
-	// loops through all of the instruction functions
-	for (int i = 0; ((state == NO_ERROR) || (state == WRONG_COMMAND)); i++) {
-		(*assembly_instructs[i])();
+	// the op code id was resolved while parsing, so the encoding is a single lookup
+	if (OP_ID >= OP_COUNT) {
+		end_list(ctx);
+		return;
 	}
+
+	STATE = encodeParams(OP_ID, PARAMS, &BIN32);
 }
 
 /*
-	Purpose: runs through each _bin function and tries to decode the parsed bits
-	Params: none
+	Purpose: looks up the instruction the parsed bits encode and unpacks its parameters
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void decode(void) {
+void decode_r(Translator_Ctx* ctx) {
 	// clears any errors
-	state = NO_ERROR;
+	STATE = NO_ERROR;
+
+	// the primary opcode picks the instruction, SPECIAL instructions are picked by their function code
+	Op_Id id = wordOp(BIN32);
+
+	// unknown encodings and words with the wrong fixed bits are rejected
+	if (id == OP_NONE) {
+		end_list(ctx);
+		return;
+	}
+
+	const struct Encoding* enc = &encodings[id];
+
+	// unpacks each field into its parameter, parameters the instruction doesn't use are left alone
+	setOpId_r(ctx, id);
+	for (int i = 0; i < MAX_FIELDS; i++) {
+		const struct Field* field = &enc->fields[i];
 
-	// loops through each instruction function
-	for (int i = 0; ((state == NO_ERROR) || (state == WRONG_COMMAND)); i++) {
-		(*binary_instructs[i])();
+		if (field->type != EMPTY) {
+			uint32_t value = (BIN32 >> field->shift) & (uint32_t)((1ull << field->width) - 1);
+			setParam_r(ctx, field->param + 1, (Param_Type)field->type, value);
+		}
 	}
+
+	STATE = COMPLETE_DECODE;
 }
 
 /*
 	Purpose: serves as an indicator for the end of the instruction list
-	Params: none
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void end_list(void) {
-	state = UNRECOGNIZED_COMMAND;
+void end_list(Translator_Ctx* ctx) {
+	STATE = UNRECOGNIZED_COMMAND;
 }
 
 
@@ -159,377 +291,446 @@ void error(char* msg) {
 \----------------------------*/
 /*
 	Purpose: prints a message based on the system status
-	Params: none
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void printResult(void) {
+void printResult_r(Translator_Ctx* ctx) {
 	// checks the current state and prints a corresponding message
-	switch (state) {
+	switch (STATE) {
 	case NO_ERROR: {
 		puts("System is Error Free");
 		break;
 	}
 	case COMPLETE_ENCODE: {
-		printMachine();
+		printMachine_r(ctx);
 		break;
 	}
 	case COMPLETE_DECODE: {
-		printAssm();
-		break;
-	}
-	case UNRECOGNIZED_COMMAND: {
-		error("The given instruction was not recognized");
-		break;
-	}
-	case UNRECOGNIZED_COND: {
-		error("The given conditional is not recognized");
-		break;
-	}
-	case MISSING_REG: {
-		error("Missing register parameter");
+		printAssm_r(ctx);
 		break;
 	}
-	case INVALID_REG: {
-		error("The given register is invalid for the specified command");
-		break;
-	}
-	case MISSING_PARAM: {
-		error("Expected a param, none was found");
-		break;
-	}
-	case INVALID_PARAM: {
-		error("The given parameter is invalid for the specified command");
-		break;
-	}
-	case UNEXPECTED_PARAM: {
-		error("Found a parameter when none was expected");
-		break;
-	}
-	case INVALID_IMMED: {
-		error("The given immediate value is invalid for the specified command");
-		break;
-	}
-	case MISSING_SPACE: {
-		error("Expected a space, none was found");
-		break;
-	}
-	case MISSING_COMMA: {
-		error("Expected a comma, none was found");
-		break;
-	}
-	case INVALID_SHIFT: {
-		error("The given shift is invalid");
+	default: {
+		error(stateMessage(STATE));
 		break;
 	}
-	case MISSING_SHIFT: {
-		error("Expected a shift value but none was found");
-		break;
 	}
+}
+
+/*
+	Purpose: gets the message describing a status code
+	Params: uint16_t status - the status to describe
+	Return: char* - the message for the status
+*/
+char* stateMessage(uint16_t status) {
+	// checks the status and returns a corresponding message
+	switch (status) {
+	case NO_ERROR: return "System is Error Free";
+	case COMPLETE_ENCODE: return "The instruction was encoded";
+	case COMPLETE_DECODE: return "The instruction was decoded";
+	case UNRECOGNIZED_COMMAND: return "The given instruction was not recognized";
+	case UNRECOGNIZED_COND: return "The given conditional is not recognized";
+	case MISSING_REG: return "Missing register parameter";
+	case INVALID_REG: return "The given register is invalid for the specified command";
+	case MISSING_PARAM: return "Expected a param, none was found";
+	case INVALID_PARAM: return "The given parameter is invalid for the specified command";
+	case UNEXPECTED_PARAM: return "Found a parameter when none was expected";
+	case INVALID_IMMED: return "The given immediate value is invalid for the specified command";
+	case MISSING_SPACE: return "Expected a space, none was found";
+	case MISSING_COMMA: return "Expected a comma, none was found";
+	case INVALID_SHIFT: return "The given shift is invalid";
+	case MISSING_SHIFT: return "Expected a shift value but none was found";
+	case UNDEFINED_LABEL: return "The given label is not defined";
+	case DUPLICATE_LABEL: return "The label is already defined";
 	case UNDEF_ERROR:
-	default: {
-		error("An unknown error code has occured");
-		break;
-	}
+	default: return "An unknown error code has occured";
 	}
 }
 
 /*
 	Purpose: prints the text instruction
-	Params: none
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void printAssm(void) {
-	// prints the op code
-	printf("%s", assm_instruct.op);
-	printf(" ");
+void printAssm_r(Translator_Ctx* ctx) {
+	char buff[FORMAT_SIZE + 1];
+
+	// formats the whole line and prints it in one write
+	size_t len = formatAssm_r(ctx, buff);
+	buff[len++] = '\n';
+
+	fwrite(buff, 1, len, stdout);
+}
+
+/*
+	Purpose: prints a parameter
+	Params: Param* param - the parameter to print
+	Return: none
+*/
+void printParam(struct Param* param) {
+	char buff[FORMAT_SIZE];
+
+	size_t len = formatParam(buff, param);
 
-	// checks param 1 and prints if it isn't empty
+	fwrite(buff, 1, len, stdout);
+}
+
+/*
+	Purpose: writes a register or immediate parameter, matching formatParam
+	Params: char* buff - where to write
+			uint8_t type - the Param_Type, REGISTER or IMMEDIATE
+			uint32_t value - the value of the parameter
+	Return: char* - the position after the parameter
+*/
+static inline char* appendParam(char* buff, uint8_t type, uint32_t value) {
+	if (type == REGISTER) {
+		return appendReg(buff, value);
+	}
+
+	return appendImm(buff, value);
+}
+
+/*
+	Purpose: writes the text instruction into a buffer, matching printAssm
+	Params: Translator_Ctx* ctx - the translation to work on
+			char* buff - the buffer to fill, at least FORMAT_SIZE bytes
+	Return: size_t - the number of characters written, not counting the terminator
+*/
+size_t formatAssm_r(Translator_Ctx* ctx, char* buff) {
+	// writes the op code
+	char* pos = appendStr(buff, OP_CODE, strlen(OP_CODE));
+	*pos++ = ' ';
+
+	// checks param 1 and writes it if it isn't empty
 	if (PARAM1.type != EMPTY) {
-		printParam(&PARAM1);
+		pos += formatParam(pos, &PARAM1);
 	}
 
-	// checks param 2 and prints if it isn't empty
+	// checks param 2 and writes it if it isn't empty
 	if (PARAM2.type != EMPTY) {
-		if (PARAM2.type == IMMEDIATE && (strcmp(OP_CODE, "LW") == 0 || strcmp(OP_CODE, "SW") == 0)) {
-			printf(", ");
-			printParam(&PARAM2);
-		}
-		else {
-			printf(", ");
-			printParam(&PARAM2);
-		}
+		pos = appendStr(pos, ", ", 2);
+		pos += formatParam(pos, &PARAM2);
 	}
 
-	// checks param 3 and prints if it isn't empty
+	// checks param 3 and writes it if it isn't empty, memory instructions put the base register in brackets
 	if (PARAM3.type != EMPTY) {
-		if (PARAM3.type == REGISTER && (strcmp(OP_CODE, "LW") == 0 || strcmp(OP_CODE, "SW") == 0)) {
-			printf("(");
-			printParam(&PARAM3);
-			printf(")");
+		if (PARAM3.type == REGISTER && (OP_ID < OP_COUNT) && (op_syntax[OP_ID] == SYNTAX_MEM)) {
+			*pos++ = '(';
+			pos += formatParam(pos, &PARAM3);
+			*pos++ = ')';
 		}
 		else {
-			printf(", ");
-			printParam(&PARAM3);
+			pos = appendStr(pos, ", ", 2);
+			pos += formatParam(pos, &PARAM3);
 		}
 	}
 
-	// checks param 4 and prints if it isn't empty
+	// checks param 4 and writes it if it isn't empty
 	if (PARAM4.type != EMPTY) {
-		printf(", ");
-		printParam(&PARAM4);
+		pos = appendStr(pos, ", ", 2);
+		pos += formatParam(pos, &PARAM4);
 	}
 
-	// prints the new line
-	printf("\n");
+	*pos = '\0';
+	return (size_t)(pos - buff);
 }
 
 /*
-	Purpose: prints a parameter
-	Params: Param* param - the parameter to print
-	Return: none
+	Purpose: writes a parameter into a buffer, matching printParam
+	Params: char* buff - the buffer to fill
+			Param* param - the parameter to write
+	Return: size_t - the number of characters written, not counting the terminator
 */
-void printParam(struct Param* param) {
-	// checks the type of parameter and prints accordingly
+size_t formatParam(char* buff, struct Param* param) {
+	char* pos = buff;
+
+	// checks the type of parameter and writes accordingly
 	switch (param->type) {
-	case EMPTY: {
-		printf("<>");
-	}
 	case REGISTER: {
-		uint32_t temp = param->value;
-		if (param->value == 0) {
-			printf("$zero");
-		}
-		else if (param->value == 2 || param->value == 3) {
-			temp -= 2;
-			printf("$v%d", temp);
-		}
-		else if (param->value >= 4 && param->value <= 7) {
-			temp -= 4;
-			printf("$a%d", temp);
-		}
-		else if (param->value >= 8 && param->value <= 15) {
-			temp -= 8;
-			printf("$t%d", temp);
-		}
-		else if (param->value >= 16 && param->value <= 23) {
-			temp -= 16;
-			printf("$s%d", temp);
-		}
-		else if (param->value == 24 || param->value == 25) {
-			temp -= 16;
-			printf("$t%d", temp);
-		}
-		else if (param->value == 28) {
-			printf("$gp");
-		}
-		else if (param->value == 29) {
-			printf("$sp");
-		}
-		else if (param->value == 30) {
-			printf("$fp");
-		}
-		else if (param->value == 31) {
-			printf("$ra");
-		}
+		pos = appendReg(pos, param->value);
 		break;
 	}
 	case IMMEDIATE: {
-		printf("#0x%X", param->value);
+		pos = appendImm(pos, param->value);
 		break;
 	}
-	default: {
-		printf("<unknown: %d, %d>", param->type, param->value);
+	case EMPTY: {
+		pos = appendStr(pos, "<>", 2);
 		break;
 	}
+	default: {
+		return (size_t)sprintf(buff, "<unknown: %d, %u>", param->type, param->value);
+	}
 	}
+
+	*pos = '\0';
+	return (size_t)(pos - buff);
 }
 
 /*
-	Purpose: prints thebinary instruction
-	Params: none
-	Return: none
+	Purpose: decodes a word straight into its text instruction without going through a
+			 context, matching decode followed by formatAssm on a cleared context
+	Params: char* buff - the buffer to fill, at least FORMAT_SIZE bytes
+			uint32_t word - the binary instruction
+	Return: size_t - the number of characters written not counting the terminator, 0 if the
+			word isn't a known instruction
 */
-void printMachine(void) {
+size_t formatWord(char* buff, uint32_t word) {
+	Op_Id id = wordOp(word);
+
+	if (id == OP_NONE) {
+		*buff = '\0';
+		return 0;
+	}
 
-	printf("Hex: 0x%08X\tBinary: ", instruct);
+	const struct Encoding* enc = &encodings[id];
 
-	// prints the binary instrution in binary form
-	for (int i = 31; i > -1; i--) {
-		printf("%d", (BIN32 >> i) & 1);
+	// unpacks the fields into parameter order, the table lists them in validation order
+	uint8_t types[MAX_FIELDS] = { EMPTY };
+	uint32_t values[MAX_FIELDS];
+	for (int i = 0; i < MAX_FIELDS; i++) {
+		const struct Field* field = &enc->fields[i];
 
-		if (i % 4 == 0) {
-			printf(" ");
+		if (field->type != EMPTY) {
+			types[field->param] = field->type;
+			values[field->param] = (word >> field->shift) & (uint32_t)((1ull << field->width) - 1);
 		}
 	}
 
-	printf("\n");
-}
+	char* pos = appendStr(buff, op_names[id], op_name_lens[id]);
+	*pos++ = ' ';
 
+	if (types[0] != EMPTY) {
+		pos = appendParam(pos, types[0], values[0]);
+	}
+
+	// the rest are separated by commas, memory instructions put the base register in brackets
+	for (int i = 1; i < MAX_FIELDS; i++) {
+		if (types[i] == EMPTY) {
+			continue;
+		}
+
+		if ((i == 2) && (types[i] == REGISTER) && (op_syntax[id] == SYNTAX_MEM)) {
+			*pos++ = '(';
+			pos = appendParam(pos, types[i], values[i]);
+			*pos++ = ')';
+		}
+		else {
+			pos = appendStr(pos, ", ", 2);
+			pos = appendParam(pos, types[i], values[i]);
+		}
+	}
+
+	*pos = '\0';
+	return (size_t)(pos - buff);
+}
 
-/*----------------------------\
-		   Parsing
-\----------------------------*/
 /*
-	reads the assembly instruction into the instruction struct
+	Purpose: prints thebinary instruction
+	Params: Translator_Ctx* ctx - the translation to work on
+	Return: none
 */
-void parseAssem(char* line) {
-	// checks that parameters are valid
-	if (line == NULL || strlen(line) == 0) {
-		state = UNDEF_ERROR;
-		return;
-	}
+void printMachine_r(Translator_Ctx* ctx) {
+	char buff[FORMAT_SIZE + 1];
 
-	// clears instruction values
-	initInstructs();
-
-	// reads op code into the instruction op code
-	if (startswith(line, "ADDI") == 1) { setOp("ADDI"); line += 4; }
-	else if (startswith(line, "ADD") == 1) { setOp("ADD"); line += 3;}
-	else if (startswith(line, "ANDI") == 1) { setOp("ANDI"); line += 4; }
-	else if (startswith(line, "AND") == 1) { setOp("AND"); line += 3;}
-	else if (startswith(line, "BEQ") == 1) { setOp("BEQ"); line += 3;}
-	else if (startswith(line, "BNE") == 1) { setOp("BNE"); line += 3;}
-	else if (startswith(line, "DIV") == 1) { setOp("DIV"); line += 3;}
-	else if (startswith(line, "LUI") == 1) { setOp("LUI"); line += 3;}
-	else if (startswith(line, "LW") == 1) { setOp("LW"); line += 2; }
-	else if (startswith(line, "MFHI") == 1) { setOp("MFHI"); line += 4;}
-	else if (startswith(line, "MFLO") == 1) { setOp("MFLO"); line += 4;}
-	else if (startswith(line, "MULT") == 1) { setOp("MULT"); line += 4;}
-	else if (startswith(line, "ORI") == 1) { setOp("ORI"); line += 3; }
-	else if (startswith(line, "OR") == 1) { setOp("OR"); line += 2;}
-	else if (startswith(line, "SLTI") == 1) { setOp("SLTI"); line += 4; }
-	else if (startswith(line, "SLT") == 1) { setOp("SLT"); line += 3;}
-	else if (startswith(line, "SUB") == 1) { setOp("SUB"); line += 3;}
-	else if (startswith(line, "SW") == 1) { setOp("SW"); line += 2; }
-	else { state = UNRECOGNIZED_COMMAND; return; }
-	
-
-	if (*line != ' ') {
-		state = MISSING_SPACE;
-		return;
-	}
+	// formats the whole line and prints it in one write
+	size_t len = formatMachine_r(ctx, buff);
+	buff[len++] = '\n';
 
-	// eat any whitespace
-	while (*line == ' ') { line++; }
+	fwrite(buff, 1, len, stdout);
+}
 
-	/*
-		Param 1
-	*/
+/*
+	Purpose: writes the binary instruction into a buffer, matching printMachine
+	Params: Translator_Ctx* ctx - the translation to work on
+			char* buff - the buffer to fill, at least FORMAT_SIZE bytes
+	Return: size_t - the number of characters written, not counting the terminator
+*/
+size_t formatMachine_r(Translator_Ctx* ctx, char* buff) {
+	char* pos = appendStr(buff, "Hex: 0x", 7);
+	pos = appendHex32(pos, BIN32);
+	pos = appendStr(pos, "\tBinary: ", 9);
 
-	// tries to read a parameter
-	line = readParam(line, &PARAM1);
+	// writes the binary instrution a nibble at a time
+	pos = appendBinary32(pos, BIN32);
 
-	// checks if there was an error or if the line is empty
-	if ((state != NO_ERROR) || (*line == '\0')) {
-		return;
-	}
+	*pos = '\0';
+	return (size_t)(pos - buff);
+}
 
-	/*
-		Param 2
-	*/
 
-	// tries to read a parameter
-	line = readParam(line, &PARAM2);
+/*----------------------------\
+		   Parsing
+\----------------------------*/
+/*
+	Purpose: gets the character at a position in a line, lines are not terminated
+	Params: const char* pos - the position to read
+			const char* end - one past the last character of the line
+	Return: char - the character, or '\0' past the end of the line
+*/
+static inline char peek(const char* pos, const char* end) {
+	return (pos < end) ? *pos : '\0';
+}
 
-	// checks if there was an error or if the line is empty
-	if ((state != NO_ERROR) || (*line == '\0')) {
-		return;
-	}
+// slot of a register name made of a lower case letter and a digit, like t0 or s7
+#define REG_SLOT(letter, digit) ((((letter) - 'a') * 10) + ((digit) - '0'))
+
+// register number + 1 of each letter and digit name, 0 for names that aren't registers
+static const uint8_t reg_digit_names[REG_SLOT('z', '9') + 1] = {
+	[REG_SLOT('v', '0')] = 2 + 1, [REG_SLOT('v', '1')] = 3 + 1,
+	[REG_SLOT('a', '0')] = 4 + 1, [REG_SLOT('a', '1')] = 5 + 1, [REG_SLOT('a', '2')] = 6 + 1, [REG_SLOT('a', '3')] = 7 + 1,
+	[REG_SLOT('t', '0')] = 8 + 1, [REG_SLOT('t', '1')] = 9 + 1, [REG_SLOT('t', '2')] = 10 + 1, [REG_SLOT('t', '3')] = 11 + 1,
+	[REG_SLOT('t', '4')] = 12 + 1, [REG_SLOT('t', '5')] = 13 + 1, [REG_SLOT('t', '6')] = 14 + 1, [REG_SLOT('t', '7')] = 15 + 1,
+	[REG_SLOT('s', '0')] = 16 + 1, [REG_SLOT('s', '1')] = 17 + 1, [REG_SLOT('s', '2')] = 18 + 1, [REG_SLOT('s', '3')] = 19 + 1,
+	[REG_SLOT('s', '4')] = 20 + 1, [REG_SLOT('s', '5')] = 21 + 1, [REG_SLOT('s', '6')] = 22 + 1, [REG_SLOT('s', '7')] = 23 + 1,
+	[REG_SLOT('t', '8')] = 24 + 1, [REG_SLOT('t', '9')] = 25 + 1,
+	[REG_SLOT('k', '0')] = 26 + 1, [REG_SLOT('k', '1')] = 27 + 1,
+	[REG_SLOT('s', '8')] = 30 + 1,
+};
 
-	// checks if there was an error
-	if (state != NO_ERROR) {
-		return;
-	}
+// two characters packed into one number so a name can be matched with a single compare
+#define REG_PAIR(first, second) ((uint32_t)(uint8_t)(first) | ((uint32_t)(uint8_t)(second) << 8))
 
-	// tries to read a parameter
-	line = readParam(line, &PARAM3);
+/*
+	Purpose: converts a register name, without the $, into its number, every ABI name and the
+			 numbers 0 to 31 are accepted
+	Params: const char* name - the start of the name, does not need to be terminated
+			size_t len - the number of characters in the name
+	Return: uint32_t - the register number, or -1 if it isn't a register
+*/
+static uint32_t lexReg(const char* name, size_t len) {
+	if (len == 2) {
+		char first = name[0];
+		char second = name[1];
+
+		// a letter followed by a digit is a single table lookup
+		if ((first >= 'a') && (first <= 'z') && (second >= '0') && (second <= '9')) {
+			return (uint32_t)reg_digit_names[REG_SLOT(first, second)] - 1;
+		}
 
-	// checks if there was an error or if the line is empty
-	if ((state != NO_ERROR) || (*line == '\0')) {
-		return;
+		// a 2 digit number, up to 31
+		if ((first >= '0') && (first <= '3') && (second >= '0') && (second <= '9')) {
+			uint32_t num = ((uint32_t)(first - '0') * 10) + (uint32_t)(second - '0');
+			return (num <= 31) ? num : (uint32_t)-1;
+		}
+
+		switch (REG_PAIR(first, second)) {
+		case REG_PAIR('a', 't'): return 1;
+		case REG_PAIR('g', 'p'): return 28;
+		case REG_PAIR('s', 'p'): return 29;
+		case REG_PAIR('f', 'p'): return 30;
+		case REG_PAIR('r', 'a'): return 31;
+		default: return (uint32_t)-1;
+		}
 	}
 
-	// checks if there was an error
-	if (state != NO_ERROR) {
-		return;
+	// a 1 digit number
+	if ((len == 1) && (name[0] >= '0') && (name[0] <= '9')) {
+		return (uint32_t)(name[0] - '0');
 	}
 
-	// tries to read a parameter
-	line = readParam(line, &PARAM4);
+	if ((len == 4) && (memcmp(name, "zero", 4) == 0)) {
+		return 0;
+	}
 
+	return (uint32_t)-1;
 }
 
-
 /*
-	Purpose: reads a parameter from a given line
-	Params: char* line - the line to read
+	Purpose: reads a parameter from a given line without a context
+	Params: const char* line - the line to read
+			const char* end - one past the last character of the line
+			uint8_t syntax - the Isa_Syntax of the instruction, only lists need a comma after each parameter
+			const Label_Scope* labels - where a label parameter is looked up, NULL if labels can't be used
 			Param* param - the parameter to fill
-	Return: char* - the ptr to after the param
+			uint16_t* state - set to the error if the parameter couldn't be read, otherwise left alone
+	Return: const char* - the ptr to after the param, NULL if it couldn't be read
 */
-char* readParam(char* line, struct Param* param) {
+static const char* scanParam(const char* line, const char* end, uint8_t syntax, const Label_Scope* labels, struct Param* param, uint16_t* state) {
 	// eat any whitespace
-	while (*line == ' ') { line++; }
+	while (peek(line, end) == ' ') { line++; }
 
 	uint8_t comma_flag;
 
 	// checks for a comma at the front, eats it if present
-	if (*line != ',') {
+	if (peek(line, end) != ',') {
 		comma_flag = 0;
 	}
 	else {
 		line++;
 		comma_flag = 1;
 	}
-	if (toupper(*line) == '(' ) {
+	if (peek(line, end) == '(') {
 		line++;
 	}
-	
 
 	// eat any whitespace
-	while (*line == ' ') { line++; }
+	while (peek(line, end) == ' ') { line++; }
 
-	if (*line == '\0') {
-		state = MISSING_PARAM;
+	if (line >= end) {
+		*state = MISSING_PARAM;
 		return NULL;
 	}
-	
 
 	// check parameter type and save value
-	if (toupper(*line) == '$') {
+	if (*line == '$') {
 		line++; // Move past the '$'
-		char reg_name[5] = { 0 };
-		int i = 0;
+		const char* name = line;
+
+		// Read the register name in place, it is never copied so any length is safe
+		while (charIs(peek(line, end), CHAR_ALNUM)) { line++; }
 
-		// Read the register name (up to 4 characters, e.g., "t1")
-		while (isalpha(*line) || isdigit(*line)) {
-			reg_name[i++] = *line++;
-		}
 		param->type = REGISTER;
 		// Convert register name to the appropriate register number
-		param->value = reg2num(reg_name);
+		param->value = lexReg(name, (size_t)(line - name));
 	}
-	else if (toupper(*line) == '#') {
+	else if (*line == '#') {
 		line++;
 		param->type = IMMEDIATE;
-		line = immd2num(line, &param->value);
+		line = immd2num(line, end, &param->value);
+
+		// numbers too big for 32 bits and a '-' without a number can't be any immediate
+		if (line == NULL) {
+			*state = INVALID_IMMED;
+			return NULL;
+		}
+	}
+	else if ((labels != NULL) && (lexLabel(line, end) != line)) {
+		const char* name = line;
+		line = lexLabel(line, end);
+
+		const Symbol* symbol = findSymbol(labels->symbols, name, (uint32_t)(line - name));
+		if (symbol == NULL) {
+			*state = UNDEFINED_LABEL;
+			return NULL;
+		}
+
+		// a label becomes the number of words from the next instruction, which has to fit the signed field
+		int64_t offset = ((int64_t)symbol->address - ((int64_t)labels->address + 4)) / 4;
+		if ((offset < INT16_MIN) || (offset > INT16_MAX)) {
+			*state = INVALID_IMMED;
+			return NULL;
+		}
+
+		param->type = IMMEDIATE;
+		param->value = (uint32_t)(int32_t)offset;
 	}
 	else {
-		state = INVALID_PARAM;
+		*state = INVALID_PARAM;
 		return NULL;
 	}
-	if (toupper(*line) == ')' ) {
+	if (peek(line, end) == ')') {
 		line++;
 	}
 	// eat any whitespace
-	while (*line == ' ') { line++; }
+	while (peek(line, end) == ' ') { line++; }
 
-	// check for comma if there wasn't one at the beginning
-	if (strcmp(OP_CODE, "LW") == 0 || strcmp(OP_CODE, "SW") == 0 || strcmp(OP_CODE, "MFLO") == 0 || strcmp(OP_CODE, "MFHI") == 0) {
+	// check for comma if there wasn't one at the beginning, only lists need one after each parameter
+	if (syntax != SYNTAX_LIST) {
 		comma_flag = 1;
 	}
 	if ((comma_flag == 0) ) {
-		if (*line != ',') {
-			state = MISSING_COMMA;
+		if (peek(line, end) != ',') {
+			*state = MISSING_COMMA;
 		}
 	}
 
@@ -539,264 +740,251 @@ char* readParam(char* line, struct Param* param) {
 }
 
 /*
-	Purpose: converts a string into a integer number
-	Params: char* reg - the string to convert
-	Return: uint32_t - value of register
+	Purpose: reads an assembly line into an op code id and parameters, the parameters are
+			 filled as they are read so they are left partly filled after an error
+	Params: const char* line - the start of the line, does not need to be terminated
+			const char* end - one past the last character of the line
+			const Label_Scope* labels - where branch labels are looked up, NULL if labels can't be used
+			Op_Id* id - filled with the op code id, OP_NONE if it wasn't recognized
+			Param* params - the 4 parameters to fill, they should be cleared first
+	Return: uint16_t - NO_ERROR, or the error that stopped the line being read
 */
-uint32_t reg2num(char* reg) {
-	// Convert register name to the appropriate register number
-	uint32_t num = 32;
-	if (strcmp(reg, "zero") == 0) { num = 0; }  // $zero is register 0 
-	else if (strcmp(reg, "v0") == 0) { num = 2; }  // $v0 is register 2
-	else if (strcmp(reg, "v1") == 0) { num = 3; }  // $v1 is register 3
-	else if (strcmp(reg, "a0") == 0) { num = 4; }  // $a0 is register 4
-	else if (strcmp(reg, "a1") == 0) { num = 5; }  // $a1 is register 5
-	else if (strcmp(reg, "a2") == 0) { num = 6; }  // $a2 is register 6
-	else if (strcmp(reg, "a3") == 0) { num = 7; }  // $a3 is register 7
-	else if (strcmp(reg, "t0") == 0) { num = 8; }  // $t0 is register 8
-	else if (strcmp(reg, "t1") == 0) { num = 9; }  // $t1 is register 9
-	else if (strcmp(reg, "t2") == 0) { num = 10; }  // $t2 is register 10
-	else if (strcmp(reg, "t3") == 0) { num = 11; }  // $t3 is register 11
-	else if (strcmp(reg, "t4") == 0) { num = 12; }  // $t4 is register 12
-	else if (strcmp(reg, "t5") == 0) { num = 13; }  // $t5 is register 13
-	else if (strcmp(reg, "t6") == 0) { num = 14; }  // $t6 is register 14
-	else if (strcmp(reg, "t7") == 0) { num = 15; }  // $t7 is register 15
-	else if (strcmp(reg, "s0") == 0) { num = 16; }  // $s0 is register 16
-	else if (strcmp(reg, "s1") == 0) { num = 17; }  // $s1 is register 17
-	else if (strcmp(reg, "s2") == 0) { num = 18; }  // $s2 is register 18
-	else if (strcmp(reg, "s3") == 0) { num = 19; }  // $s3 is register 19
-	else if (strcmp(reg, "s4") == 0) { num = 20; }  // $s4 is register 20 
-	else if (strcmp(reg, "s5") == 0) { num = 21; }  // $s5 is register 21
-	else if (strcmp(reg, "s6") == 0) { num = 22; }  // $s6 is register 22 
-	else if (strcmp(reg, "s7") == 0) { num = 23; }  // $s7 is register 23
-	else if (strcmp(reg, "t8") == 0) { num = 24; }  // $t8 is register 24
-	else if (strcmp(reg, "t9") == 0) { num = 25; }  // $t9 is register 25
-	else if (strcmp(reg, "gp") == 0) { num = 28; }  // $gp is register 28
-	else if (strcmp(reg, "sp") == 0) { num = 29; }  // $sp is register 29
-	else if (strcmp(reg, "fp") == 0) { num = 30; }  // $fp is register 30
-	else if (strcmp(reg, "ra") == 0) { num = 31; }  // $ra is register 31
-	else { return -1; }
-	return num;
-}
-
-
-/*
-	Purpose: converts a string into either a hex or decimal number
-	Params: char* line - the string to convert
-			uint32_t* value - the number to fill
-	Return: char* - the ptr to after the number
-*/
-char* immd2num(char* line, uint32_t* value) {
-	uint32_t num = 0;
+static uint16_t scanLine(const char* line, const char* end, const Label_Scope* labels, Op_Id* id, struct Param* params) {
+	// finds the end of the op code
+	const char* op_end = line;
+	while (charIs(peek(op_end, end), CHAR_ALPHA)) { op_end++; }
 
-	// checks if the number is prefixed for hex
-	if ((*line == '0') && (toupper(*(line + 1)) == 'X')) {
-		line += 2;
+	// looks up the op code, which picks the syntax of the parameters
+	*id = lookupOp(line, (uint32_t)(op_end - line));
+	if (*id == OP_NONE) {
+		return UNRECOGNIZED_COMMAND;
+	}
+	uint8_t syntax = op_syntax[*id];
+	line = op_end;
 
-		// as long as there are valid digits, they are added to the running number
-		while (isxdigit(*line)) {
-			if (isdigit(*line)) {
-				num = (num * 16) + (*line - 48);
-			}
-			else {
-				num = (num * 16) + (toupper(*line) - 55);
-			}
+	// only branches take a label
+	if (op_signs[*id] != IMM_BRANCH) {
+		labels = NULL;
+	}
 
-			line++;
-		}
+	if (peek(line, end) != ' ') {
+		return MISSING_SPACE;
 	}
-	else {
-		// as long as there are valid digits, they are added to the running number
-		while (isdigit(*line)) {
-			num = (num * 10) + (*line - 48);
-			line++;
+
+	// eat any whitespace
+	while (peek(line, end) == ' ') { line++; }
+
+	// reads up to 4 parameters, stopping at the end of the line or the first error
+	uint16_t state = NO_ERROR;
+	for (int i = 0; i < 4; i++) {
+		line = scanParam(line, end, syntax, labels, &params[i], &state);
+
+		if ((state != NO_ERROR) || (line >= end)) {
+			break;
 		}
 	}
 
-	// sets the gven number ptr
-	*value = num;
-
-	// updates line ptr
-	return line;
+	return state;
 }
 
-
 /*
-	Purpose: parses the given hex line into into the binary instruction
-	Params: char* line - the line to convert
+	Purpose: reads the assembly instruction into the instruction struct
+	Params: Translator_Ctx* ctx - the translation to work on
+			const char* line - the start of the line, does not need to be terminated
+			size_t len - the number of characters in the line
 	Return: none
 */
-void parseHex(char* line) {
+void parseAssem_r(Translator_Ctx* ctx, const char* line, size_t len) {
 	// checks that parameters are valid
-	if (line == NULL || strlen(line) == 0) {
-		state = UNDEF_ERROR;
+	if (line == NULL || len == 0) {
+		STATE = UNDEF_ERROR;
 		return;
 	}
 
 	// clears instruction values
-	initInstructs();
+	initInstructs_r(ctx);
 
-	uint32_t num = 0;
+	Op_Id id;
+	STATE = scanLine(line, line + len, NULL, &id, PARAMS);
+	setOpId_r(ctx, id);
+}
 
-	// checks if there is a hex prefix
-	if ((*line == '0') && (toupper(*(line + 1)) == 'X')) {
-		line += 2;
+/*
+	Purpose: assembles one line straight into a binary instruction without a context,
+			 matching parseAssem followed by encode, branches can also be given a label
+	Params: const char* line - the start of the line, does not need to be terminated
+			size_t len - the number of characters in the line
+			const Label_Scope* labels - where branch labels are looked up, NULL if labels can't be used
+			uint32_t* word - filled with the binary instruction if there wasn't an error
+	Return: uint16_t - COMPLETE_ENCODE, or the error that stopped the line being assembled
+*/
+uint16_t assembleLine(const char* line, size_t len, const Label_Scope* labels, uint32_t* word) {
+	if (line == NULL || len == 0) {
+		return UNDEF_ERROR;
 	}
 
-	// as long as there are valid digits, they are added to the running number
-	while (isxdigit(*line)) {
-		if (isdigit(*line)) {
-			num = (num * 16) + (*line - 48);
-		}
-		else {
-			num = (num * 16) + (toupper(*line) - 55);
-		}
+	// parameters that aren't read stay empty, like initInstructs leaves them
+	struct Param params[4] = { { EMPTY, 0 }, { EMPTY, 0 }, { EMPTY, 0 }, { EMPTY, 0 } };
+	Op_Id id;
 
-		line++;
+	uint16_t state = scanLine(line, line + len, labels, &id, params);
+	if (state != NO_ERROR) {
+		return state;
 	}
 
-	// sets the binary instruction to the converted number
-	BIN32 = num;
+	return encodeParams(id, params, word);
 }
 
-
 /*
-	Purpose: parses the given binary line into into the binary instruction
-	Params: char* line - the line to convert
-	Return: none
+	Purpose: finds a label definition, like "loop:", at the start of a line
+	Params: const char* line - the start of the line, after any leading whitespace
+			size_t len - the number of characters in the line
+	Return: size_t - the length of the label name, the ':' follows it, 0 if the line doesn't define a label
 */
-void parseBin(char* line) {
-	// checks that parameters are valid
-	if (line == NULL || strlen(line) == 0) {
-		state = UNDEF_ERROR;
-		return;
+size_t labelDefinition(const char* line, size_t len) {
+	const char* end = line + len;
+	const char* name_end = lexLabel(line, end);
+
+	if ((name_end == line) || (peek(name_end, end) != ':')) {
+		return 0;
 	}
 
-	// clears instruction values
-	initInstructs();
+	return (size_t)(name_end - line);
+}
 
-	uint32_t num = 0;
 
-	// checks if there is a binary prefix
-	if ((*line == '0') && (toupper(*(line + 1)) == 'b')) {
-		line += 2;
-	}
+/*
+	Purpose: reads a parameter from a given line
+	Params: Translator_Ctx* ctx - the translation to work on
+			const char* line - the line to read
+			const char* end - one past the last character of the line
+			Param* param - the parameter to fill
+	Return: const char* - the ptr to after the param
+*/
+const char* readParam_r(Translator_Ctx* ctx, const char* line, const char* end, struct Param* param) {
+	uint8_t syntax = (OP_ID < OP_COUNT) ? op_syntax[OP_ID] : SYNTAX_LIST;
+	uint16_t state = NO_ERROR;
 
-	// as long as there are valid digits, they are added to the running number
-	while (*line != '\0') {
-		if ((*line == '0') || (*line == '1')) {
-			num = (num * 2) + (*line - 48);
-		}
-		line++;
+	line = scanParam(line, end, syntax, NULL, param, &state);
+	if (state != NO_ERROR) {
+		STATE = state;
 	}
 
-	// sets the binary instruction to the converted number
-	BIN32 = num;
+	return line;
 }
 
-
-
-/*----------------------------\
-		   Set Bits
-\----------------------------*/
 /*
-	Purpose: sets bits in the binary instruction given a number and a number of bits
-	Params: uint32_t start - the bit to start at
-			uint32_t num - the number to use as a source of bits
-			uint32_t size - the number of bits to set
-	Return: none
+	Purpose: converts a register name, without the $, into its number
+	Params: char* reg - the name to convert, an ABI name like t0 or a number from 0 to 31
+	Return: uint32_t - the register number, or -1 if it isn't a register
 */
-void setBits_num(uint32_t start, uint32_t num, uint32_t size) {
-	// temp string for conversion purposes
-	char str[40] = { '\0' };
+uint32_t reg2num(char* reg) {
+	return lexReg(reg, strlen(reg));
+}
 
-	// converts the number to a string of the needed size
-	num2bin(str, num, size);
 
-	// sets the bits in the binary instruction
-	setBits_str(start, str);
+/*
+	Purpose: converts a string into a decimal, hex (0x) or binary (0b) number, which can be negative
+	Params: const char* line - the string to convert
+			const char* end - one past the last character of the string
+			uint32_t* value - the number to fill, negative numbers as two's complement
+	Return: const char* - the ptr to after the number, NULL if it doesn't fit in 32 bits or is a
+			lone '-'
+*/
+const char* immd2num(const char* line, const char* end, uint32_t* value) {
+	return lexNumber(line, end, value);
 }
 
 
 /*
-	Purpose: sets bits in the binary instruction given a string
-	Params: uint32_t start - the bit to start at
-			const char* str - the string to use as a source of bits, skips any x or X characters
+	Purpose: parses the given hex line into into the binary instruction
+	Params: Translator_Ctx* ctx - the translation to work on
+			const char* line - the line to convert, does not need to be terminated
+			size_t len - the number of characters in the line
 	Return: none
 */
-void setBits_str(uint32_t start, const char* str) {
-	// loops through the sting ad sets the bits in the binary instruction
-	for (int i = 0; i < strlen(str); i++) {
-		if ((str[i] == '0') || (str[i] == '1')) {
-			BIN32 |= (str[i] - 48) << (start - i);
-		}
+void parseHex_r(Translator_Ctx* ctx, const char* line, size_t len) {
+	// checks that parameters are valid
+	if (line == NULL || len == 0) {
+		STATE = UNDEF_ERROR;
+		return;
 	}
-}
 
+	const char* end = line + len;
 
-/*----------------------------\
-		  Check Bits
-\----------------------------*/
-/*
-	Purpose: checks if the given series of bits is in the binary instruction
-	Params: uint32_t start - the bit to start at
-			const char* str - the series of bits to look for, skips any x or X characters
-	Return: int - 0 for present, 1 for not present
-*/
-int checkBits(uint32_t start, const char* str) {
-	// loops thorugh and checks each bit in the bianry instruction
-	for (int i = 0; i < strlen(str); i++) {
-		// skips anything that isn't a 1 or 0
-		if ((str[i] != '0') && (str[i] != '1')) {
-			continue;
-		}
+	// clears instruction values
+	initInstructs_r(ctx);
 
-		if ((str[i] - 48) != ((BIN32 >> (start - i)) & 0x1)) {
-			return 1;
-		}
+	uint32_t num = 0;
+
+	// checks if there is a hex prefix
+	if ((peek(line, end) == '0') && ((peek(line + 1, end) | 0x20) == 'x')) {
+		line += 2;
 	}
 
-	// no error
-	return 0;
+	// as long as there are valid digits, they are added to the running number
+	while (charIs(peek(line, end), CHAR_HEX)) {
+		num = (num * 16) + hexValue(*line);
+		line++;
+	}
+
+	// sets the binary instruction to the converted number
+	BIN32 = num;
 }
 
 
-/*----------------------------\
-		   Get Bits
-\----------------------------*/
 /*
-	Purpose: gets a group of bits from the binary instruction
-	Params: uint32_t start - the bit to strt grabbing from
-			uint32_t the number of bits to grab
-	Return: int - the number represented from the bits
+	Purpose: parses the given binary line into into the binary instruction
+	Params: Translator_Ctx* ctx - the translation to work on
+			const char* line - the line to convert, does not need to be terminated
+			size_t len - the number of characters in the line
+	Return: none
 */
-uint32_t getBits(uint32_t start, uint32_t size) {
+void parseBin_r(Translator_Ctx* ctx, const char* line, size_t len) {
+	// checks that parameters are valid
+	if (line == NULL || len == 0) {
+		STATE = UNDEF_ERROR;
+		return;
+	}
+
+	const char* end = line + len;
+
+	// clears instruction values
+	initInstructs_r(ctx);
+
 	uint32_t num = 0;
 
-	// finds the last bit to grab, non-inclusive
-	int end = start - size;
+	// checks if there is a binary prefix
+	if ((peek(line, end) == '0') && ((peek(line + 1, end) | 0x20) == 'b')) {
+		line += 2;
+	}
 
-	// loops through each bit and adds it to the running num
-	for (int i = start; i > end; i--) {
-		num = (num * 2) + ((BIN32 >> i) & 0x1);
+	// as long as there are valid digits, they are added to the running number
+	while (line < end) {
+		if ((*line == '0') || (*line == '1')) {
+			num = (num * 2) + (*line - 48);
+		}
+		line++;
 	}
 
-	// returns the extracted number
-	return num;
+	// sets the binary instruction to the converted number
+	BIN32 = num;
 }
 
 
+
 /*----------------------------\
 	 Set Instruction Parts
 \----------------------------*/
 /*
 	Purpose: sets the specified parameter to the specified type and value
-	Params: uint32_t param_num - which parameter to change
+	Params: Translator_Ctx* ctx - the translation to work on
+			uint32_t param_num - which parameter to change
 			Param_Type type - what type to set the parameter to
 			uint32_t value - what value to set the parameter to
 	Return: 0 for no error
 */
-int setParam(uint32_t param_num, Param_Type type, uint32_t value) {
+int setParam_r(Translator_Ctx* ctx, uint32_t param_num, Param_Type type, uint32_t value) {
 	// finds which parameter is being set and set the type and value
 	switch (param_num) {
 	case 1: {
@@ -830,82 +1018,113 @@ int setParam(uint32_t param_num, Param_Type type, uint32_t value) {
 }
 
 /*
-	Purpose: sets the opcode field in the instruction
-	Params: char* opCode - string to set the op code to
+	Purpose: sets the opcode field and op code id in the instruction
+	Params: Translator_Ctx* ctx - the translation to work on
+			Op_Id id - the id of the op code to set
 	Return: none
 */
-void setOp(char* opCode) {
-	for (int i = 0; i < OP_SIZE; i++) {
-		OP_CODE[i] = *opCode++;
+void setOpId_r(Translator_Ctx* ctx, Op_Id id) {
+	OP_ID = id;
 
-		if (*opCode == '\0') {
-			OP_CODE[i + 1] = '\0';
-			break;
-		}
+	if (id == OP_NONE) {
+		OP_CODE[0] = '\0';
+		return;
 	}
+
+	// the names are all shorter than OP_SIZE
+	strcpy(OP_CODE, op_names[id]);
 }
 
 
 /*----------------------------\
-			 Misc
+		Op Code Lookup
 \----------------------------*/
 /*
-	Purpose: fills a string with a binary version of a number, and insures a minimum length
-	Params: char* str - the string to fill, uint32_t num - the number to convert, uint32_t size - the minimum size
-	Return: char* - the same as the str pointer
+	Purpose: finds the id of a mnemonic, ignoring case
+	Params: const char* mnemonic - the start of the mnemonic, does not need to be terminated
+			uint32_t len - the number of characters in the mnemonic
+	Return: Op_Id - the id of the mnemonic, or OP_NONE if it isn't recognized
 */
-char* num2bin(char* str, uint32_t num, uint32_t size) {
-	int index = 0;
-
-	// extracts the LSB until the numebr is zero
-	while (num > 0) {
-		str[index++] = (num % 2) + 48;
-		num /= 2;
+Op_Id lookupOp(const char* mnemonic, uint32_t len) {
+	if ((len < OP_NAME_MIN) || (len > OP_NAME_MAX)) {
+		return OP_NONE;
 	}
 
-	// makes sure that the string is terminated
-	str[index] = '\0';
+	// upper cases the letters used by the hash
+	char first = mnemonic[0] & ~0x20;
+	char second = mnemonic[1] & ~0x20;
+	char last = mnemonic[len - 1] & ~0x20;
+
+	uint8_t slot = op_hash_table[OP_HASH(first, second, last, len)];
+	if (slot == 0) {
+		return OP_NONE;
+	}
+	uint8_t id = slot - 1;
 
-	// zeros to fill to the minimum size
-	while (strlen(str) < size) {
-		str[index++] = '0';
-		str[index] = '\0';
+	// confirms the mnemonic is the one in the slot
+	if (op_name_lens[id] != len) {
+		return OP_NONE;
 	}
 
-	// swaps the bits to reverse the string
-	index--;
-	for (int i = 0; i < index; i++, index--) {
-		char c = str[index];
-		str[index] = str[i];
-		str[i] = c;
+	const char* name = op_names[id];
+	for (uint32_t i = 0; i < len; i++) {
+		if ((mnemonic[i] & ~0x20) != name[i]) {
+			return OP_NONE;
+		}
 	}
 
-	// returns the str ptr
-	return str;
+	return (Op_Id)id;
 }
 
-/*
-	Purpose: checks if the given prefix is at the beginning of the given string
-	Params: char* line - the string to search in
-			char* prefix - the string to search for
-	Return: 0 if they don't match, 1 if they do
-*/
-int startswith(char* line, char* prefix) {
-	while (*prefix != '\0') {
-		char c1 = *line++;
-		char c2 = *prefix++;
+/*----------------------------\
+	   Default Context
+\----------------------------*/
+// each function below runs the matching _r function on default_ctx
 
-		if ((c1 <= 'z') && (c1 >= 'a')) {
-			c1 -= 32;
-		}
+void initInstructs(void) {
+	initInstructs_r(&default_ctx);
+}
 
-		if ((c2 <= 'z') && (c2 >= 'a')) {
-			c2 -= 32;
-		}
+void encode(void) {
+	encode_r(&default_ctx);
+}
 
-		if (c2 != c1) {
-			return 0;
-		}
-	}
-	return 1;
+void decode(void) {
+	decode_r(&default_ctx);
+}
+
+void printResult(void) {
+	printResult_r(&default_ctx);
+}
+
+void printAssm(void) {
+	printAssm_r(&default_ctx);
+}
+
+void printMachine(void) {
+	printMachine_r(&default_ctx);
+}
+
+void parseAssem(char* line) {
+	parseAssem_r(&default_ctx, line, (line == NULL) ? 0 : strlen(line));
+}
+
+char* readParam(char* line, struct Param* param) {
+	return (char*)readParam_r(&default_ctx, line, line + strlen(line), param);
+}
+
+void parseHex(char* line) {
+	parseHex_r(&default_ctx, line, (line == NULL) ? 0 : strlen(line));
+}
+
+void parseBin(char* line) {
+	parseBin_r(&default_ctx, line, (line == NULL) ? 0 : strlen(line));
+}
+
+int setParam(uint32_t param_num, Param_Type type, uint32_t value) {
+	return setParam_r(&default_ctx, param_num, type, value);
+}
+
+void setOpId(Op_Id id) {
+	setOpId_r(&default_ctx, id);
 }
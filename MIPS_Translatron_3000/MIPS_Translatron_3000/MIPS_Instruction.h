@@ -7,9 +7,77 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
 #include "global_data.h"
-#include "Instruction.h"
+#include "MIPS_Format.h"
+#include "MIPS_Lex.h"
+#include "MIPS_Symbols.h"
+
+// size of a buffer that can hold any formatted instruction
+#define FORMAT_SIZE 128
+
+// where the label operands of a line are looked up, for assembling a line at a known address
+typedef struct {
+	const Symbol_Table* symbols;	// the labels of the file
+	uint32_t address;				// the byte address of the word the line assembles to
+} Label_Scope;
+
+// mnemonic text for each Op_Id
+extern const char* const op_names[OP_COUNT];
+
+// how the parameters of each instruction are written, indexed by Op_Id
+extern const uint8_t op_syntax[OP_COUNT];
+
+// how the immediate of each instruction is read, indexed by Op_Id
+extern const uint8_t op_signs[OP_COUNT];
+
+// binary layout of each instruction indexed by Op_Id
+extern const struct Encoding encodings[OP_COUNT];
+
+// fixed bits of each instruction indexed by Op_Id
+extern const struct Bit_Pattern patterns[OP_COUNT];
+
+/*
+	BITS_MASK(start, size) builds the mask of size bits whose most significant bit is start,
+	at compile time
+*/
+#define BITS_MASK(start, size) ((uint32_t)(((1ull << (size)) - 1) << ((start) + 1 - (size))))
+
+/*
+	ISA_FIELDS(X) lists every field of an instruction word as X(name, shift, width),
+	each one gets an accessor field_<name>(word) that is a single shift and mask
+*/
+#define ISA_FIELDS(X) \
+	X(opcode, 26, 6) \
+	X(rs, 21, 5) \
+	X(rt, 16, 5) \
+	X(rd, 11, 5) \
+	X(shamt, 6, 5) \
+	X(funct, 0, 6) \
+	X(imm16, 0, 16) \
+	X(target26, 0, 26)
+
+#define FIELD_ACCESSOR(name, shift, width) \
+	static inline uint32_t field_##name(uint32_t word) { return (word >> (shift)) & ((1u << (width)) - 1); }
+ISA_FIELDS(FIELD_ACCESSOR)
+#undef FIELD_ACCESSOR
+
+// FIELD_SHIFT_<name> and FIELD_WIDTH_<name> give the position of each field as constants
+#define FIELD_CONSTANTS(name, shift, width) FIELD_SHIFT_##name = (shift), FIELD_WIDTH_##name = (width),
+enum Field_Layout { ISA_FIELDS(FIELD_CONSTANTS) };
+#undef FIELD_CONSTANTS
+
+// FIELD_MASK(name) is the bits a field covers in the instruction word
+#define FIELD_MASK(name) BITS_MASK(FIELD_SHIFT_##name + FIELD_WIDTH_##name - 1, FIELD_WIDTH_##name)
+
+/*
+	ISA_PATTERN_MASK(format, zeros) and ISA_PATTERN_MATCH(opcode, funct) build the fixed bits of
+	an ISA_TABLE row, register functions also fix the function code, and DECODE_INDEX(format,
+	opcode, funct) is its entry in the decode tables, the opcode or 64 + the function code for
+	SPECIAL instructions
+*/
+#define ISA_PATTERN_MASK(format, zeros) (FIELD_MASK(opcode) | (((format) == FORMAT_R) ? FIELD_MASK(funct) : 0) | (zeros))
+#define ISA_PATTERN_MATCH(opcode, funct) (((uint32_t)(opcode) << 26) | (funct))
+#define DECODE_INDEX(format, opcode, funct) (((format) == FORMAT_R) ? 64 + (funct) : (opcode))
 
 /*
 	gets(char* buffer, int size)
@@ -19,33 +87,33 @@
 #define gets(x,y); if(fgets(x,y,stdin) != NULL){x[strlen(x)-1] = '\0';}
 
 /*
-	Purpose: sets the global instrucion variables to the defualt values
-	Params: none
+	Purpose: sets the instrucion variables in the context to the defualt values
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void initInstructs(void);
+void initInstructs_r(Translator_Ctx* ctx);
 
 
 /*
-	Purpose: runs through each _assm function and tries to encode the parsed instruction
-	Params: none
+	Purpose: checks the parameters against the encoding of the parsed op code and packs them
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void encode(void);
+void encode_r(Translator_Ctx* ctx);
 
 /*
-	Purpose: runs through each _bin function and tries to decode the parsed bits
-	Params: none
+	Purpose: looks up the instruction the parsed bits encode and unpacks its parameters
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void decode(void);
+void decode_r(Translator_Ctx* ctx);
 
 /*
 	Purpose: serves as an indicator for the end of the instruction list
-	Params: none
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void end_list(void);
+void end_list(Translator_Ctx* ctx);
 
 
 /*----------------------------\
@@ -64,17 +132,24 @@ void error(char* msg);
 \----------------------------*/
 /*
 	Purpose: prints a message based on the system status
-	Params: none
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void printResult(void);
+void printResult_r(Translator_Ctx* ctx);
+
+/*
+	Purpose: gets the message describing a status code
+	Params: uint16_t status - the status to describe
+	Return: char* - the message for the status
+*/
+char* stateMessage(uint16_t status);
 
 /*
 	Purpose: prints the text instruction
-	Params: none
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void printAssm(void);
+void printAssm_r(Translator_Ctx* ctx);
 
 /*
 	Purpose: prints a parameter
@@ -85,111 +160,170 @@ void printParam(struct Param* param);
 
 //void printShift();
 
+/*
+	Purpose: writes the text instruction into a buffer, matching printAssm
+	Params: Translator_Ctx* ctx - the translation to work on
+			char* buff - the buffer to fill, at least FORMAT_SIZE bytes
+	Return: size_t - the number of characters written, not counting the terminator
+*/
+size_t formatAssm_r(Translator_Ctx* ctx, char* buff);
+
+/*
+	Purpose: writes a parameter into a buffer, matching printParam
+	Params: char* buff - the buffer to fill
+			Param* param - the parameter to write
+	Return: size_t - the number of characters written, not counting the terminator
+*/
+size_t formatParam(char* buff, struct Param* param);
+
+/*
+	Purpose: decodes a word straight into its text instruction without going through a
+			 context, matching decode followed by formatAssm on a cleared context
+	Params: char* buff - the buffer to fill, at least FORMAT_SIZE bytes
+			uint32_t word - the binary instruction
+	Return: size_t - the number of characters written not counting the terminator, 0 if the
+			word isn't a known instruction
+*/
+size_t formatWord(char* buff, uint32_t word);
+
 /*
 	Purpose: prints thebinary instruction
-	Params: none
+	Params: Translator_Ctx* ctx - the translation to work on
 	Return: none
 */
-void printMachine(void);
+void printMachine_r(Translator_Ctx* ctx);
+
+/*
+	Purpose: writes the binary instruction into a buffer, matching printMachine
+	Params: Translator_Ctx* ctx - the translation to work on
+			char* buff - the buffer to fill, at least FORMAT_SIZE bytes
+	Return: size_t - the number of characters written, not counting the terminator
+*/
+size_t formatMachine_r(Translator_Ctx* ctx, char* buff);
 
 
 /*----------------------------\
 		   Parsing
 \----------------------------*/
 /*
-	reads the assembly instruction into the instruction struct
+	Purpose: reads the assembly instruction into the instruction struct
+	Params: Translator_Ctx* ctx - the translation to work on
+			const char* line - the start of the line, does not need to be terminated
+			size_t len - the number of characters in the line
+	Return: none
 */
-void parseAssem(char* line);
+void parseAssem_r(Translator_Ctx* ctx, const char* line, size_t len);
+
+
+/*
+	Purpose: assembles one line straight into a binary instruction without a context,
+			 matching parseAssem followed by encode, branches can also be given a label
+	Params: const char* line - the start of the line, does not need to be terminated
+			size_t len - the number of characters in the line
+			const Label_Scope* labels - where branch labels are looked up, NULL if labels can't be used
+			uint32_t* word - filled with the binary instruction if there wasn't an error
+	Return: uint16_t - COMPLETE_ENCODE, or the error that stopped the line being assembled
+*/
+uint16_t assembleLine(const char* line, size_t len, const Label_Scope* labels, uint32_t* word);
+
+/*
+	Purpose: finds a label definition, like "loop:", at the start of a line
+	Params: const char* line - the start of the line, after any leading whitespace
+			size_t len - the number of characters in the line
+	Return: size_t - the length of the label name, the ':' follows it, 0 if the line doesn't define a label
+*/
+size_t labelDefinition(const char* line, size_t len);
 
 
 /*
 	Purpose: reads a parameter from a given line
-	Params: char* line - the line to read
+	Params: Translator_Ctx* ctx - the translation to work on
+			const char* line - the line to read
+			const char* end - one past the last character of the line
 			Param* param - the parameter to fill
-	Return: char* - the ptr to after the param
+	Return: const char* - the ptr to after the param
 */
-char* readParam(char* line, struct Param* param);
+const char* readParam_r(Translator_Ctx* ctx, const char* line, const char* end, struct Param* param);
 
 
 /*
-	Purpose: converts a string into a decimal number
-	Params: char *reg - the string to convert
-	Return: char* - the ptr to after the number
+	Purpose: converts a register name, without the $, into its number
+	Params: char* reg - the name to convert, an ABI name like t0 or a number from 0 to 31
+	Return: uint32_t - the register number, or -1 if it isn't a register
 */
 uint32_t reg2num(char *reg);
 
 
 /*
-	Purpose: converts a string into either a hex or decimal number
-	Params: char* line - the string to convert
-			uint32_t* value - the number to fill
-	Return: char* - the ptr to after the number
+	Purpose: converts a string into a decimal, hex (0x) or binary (0b) number, which can be negative
+	Params: const char* line - the string to convert
+			const char* end - one past the last character of the string
+			uint32_t* value - the number to fill, negative numbers as two's complement
+	Return: const char* - the ptr to after the number, NULL if it doesn't fit in 32 bits or is a
+			lone '-'
 */
-char* immd2num(char* line, uint32_t* value);
+const char* immd2num(const char* line, const char* end, uint32_t* value);
 
 
 /*
 	Purpose: parses the given hex line into into the binary instruction
-	Params: char* line - the line to convert
+	Params: Translator_Ctx* ctx - the translation to work on
+			const char* line - the line to convert, does not need to be terminated
+			size_t len - the number of characters in the line
 	Return: none
 */
-void parseHex(char* line);
+void parseHex_r(Translator_Ctx* ctx, const char* line, size_t len);
 
 
 /*
 	Purpose: parses the given binary line into into the binary instruction
-	Params: char* line - the line to convert
+	Params: Translator_Ctx* ctx - the translation to work on
+			const char* line - the line to convert, does not need to be terminated
+			size_t len - the number of characters in the line
 	Return: none
 */
-void parseBin(char* line);
+void parseBin_r(Translator_Ctx* ctx, const char* line, size_t len);
 
 
 
 
 /*----------------------------\
-		   Set Bits
+		  Pack Fields
 \----------------------------*/
 /*
-	Purpose: sets bits in the binary instruction given a number and a number of bits
-	Params: uint32_t start - the bit to start at
-			uint32_t num - the number to use as a source of bits
-			uint32_t size - the number of bits to set
-	Return: none
+	Purpose: builds a binary instruction from an encoding and the parameters
+	Params: const struct Encoding* enc - the layout of the instruction
+			const struct Param* params - the parameters to pack, indexed by the fields
+	Return: uint32_t - the binary instruction
 */
-void setBits_num(uint32_t start, uint32_t num, uint32_t size);
+static inline uint32_t packFields(const struct Encoding* enc, const struct Param* params) {
+	uint32_t bin = enc->base;
 
+	// unused fields have a width of 0, so their mask clears the value
+	for (int i = 0; i < MAX_FIELDS; i++) {
+		const struct Field* field = &enc->fields[i];
+		uint32_t mask = (uint32_t)((1ull << field->width) - 1);
 
-/*
-	Purpose: sets bits in the binary instruction given a string
-	Params: uint32_t start - the bit to start at
-			const char* str - the string to use as a source of bits, skips any x or X characters
-	Return: none
-*/
-void setBits_str(uint32_t start, const char* str);
+		bin |= (params[field->param].value & mask) << field->shift;
+	}
 
-
-/*----------------------------\
-		  Check Bits
-\----------------------------*/
-/*
-	Purpose: checks if the given series of bits is in the binary instruction
-	Params: uint32_t start - the bit to start at
-			const char* str - the series of bits to look for, skips any x or X characters
-	Return: int - 0 for present, 1 for not present
-*/
-int checkBits(uint32_t start, const char* str);
+	return bin;
+}
 
 
 /*----------------------------\
-		   Get Bits
+		 Match Patterns
 \----------------------------*/
 /*
-	Purpose: gets a group of bits from the binary instruction
-	Params: uint32_t start - the bit to strt grabbing from
-			uint32_t the number of bits to grab
-	Return: int - the number represented from the bits
+	Purpose: checks if a binary instruction matches a compiled pattern
+	Params: uint32_t bin - the binary instruction to check
+			struct Bit_Pattern pattern - the pattern to look for
+	Return: int - 1 for a match, 0 for no match
 */
-uint32_t getBits(uint32_t start, uint32_t size);
+static inline int matchPattern(uint32_t bin, struct Bit_Pattern pattern) {
+	return (bin & pattern.mask) == pattern.match;
+}
+
 
 /*----------------------------\
 		   Binary to Register
@@ -208,59 +342,54 @@ uint32_t getBits(uint32_t start, uint32_t size);
 \----------------------------*/
 /*
 	Purpose: sets the specified parameter to the specified type and value
-	Params: uint32_t param_num - which parameter to change
+	Params: Translator_Ctx* ctx - the translation to work on
+			uint32_t param_num - which parameter to change
 			Param_Type type - what type to set the parameter to
 			uint32_t value - what value to set the parameter to
 	Return: 0 for no error
 */
-int setParam(uint32_t param_num, Param_Type type, uint32_t value);
+int setParam_r(Translator_Ctx* ctx, uint32_t param_num, Param_Type type, uint32_t value);
 
 /*
-	Purpose: sets the opcode field in the instruction
-	Params: char* opCode - string to set the op code to
+	Purpose: sets the opcode field and op code id in the instruction
+	Params: Translator_Ctx* ctx - the translation to work on
+			Op_Id id - the id of the op code to set
 	Return: none
 */
-void setOp(char* opCode);
-
+void setOpId_r(Translator_Ctx* ctx, Op_Id id);
 
 
 /*----------------------------\
-			 Misc
+		Op Code Lookup
 \----------------------------*/
 /*
-	Purpose: fills a string with a binary version of a number, and insures a minimum length
-	Params: char* str - the string to fill, uint32_t num - the number to convert, uint32_t size - the minimum size
-	Return: char* - the same as the str pointer
+	Purpose: finds the id of a mnemonic, ignoring case
+	Params: const char* mnemonic - the start of the mnemonic, does not need to be terminated
+			uint32_t len - the number of characters in the mnemonic
+	Return: Op_Id - the id of the mnemonic, or OP_NONE if it isn't recognized
 */
-char* num2bin(char* str, uint32_t num, uint32_t size);
+Op_Id lookupOp(const char* mnemonic, uint32_t len);
 
-/*
-	Purpose: converts a condition string to number
-	Params: char* cond - the condition to convert
-	Return: bit code for the condition
-*/
-//int cond2num(char* cond);
 
-/*
-	Purpose: converts a shift type to number
-	Params: Shift_Type shift - the shift to convert
-	Return: bit code for the shift
-*/
-//int shift2num(Shift_Type shift);
-
-/*
-	Purpose: converts a number to a shift type
-	Params: int shift_code - the number to convert
-	Return: Shift_Type for the code
-*/
-//Shift_Type num2shift(int shift_code);
 
+/*----------------------------\
+	   Default Context
+\----------------------------*/
 /*
-	Purpose: checks if the given prefix is at the beginning of the given string
-	Params: char* line - the string to search in
-			char* prefix - the string to search for
-	Return: 0 if they don't match, 1 if they do
+	The functions below work on default_ctx, each is the same as calling the
+	matching _r function with &default_ctx
 */
-int startswith(char* line, char* prefix);
+void initInstructs(void);
+void encode(void);
+void decode(void);
+void printResult(void);
+void printAssm(void);
+void printMachine(void);
+void parseAssem(char* line);
+char* readParam(char* line, struct Param* param);
+void parseHex(char* line);
+void parseBin(char* line);
+int setParam(uint32_t param_num, Param_Type type, uint32_t value);
+void setOpId(Op_Id id);
 
 #endif
\ No newline at end of file
@@ -1,10 +1,17 @@
 #include "MIPS_Interpreter.h"
 #include "test_bench.h"
+#include "benchmark.h"
+#include "MIPS_Batch.h"
 
-int main(void) {
+int main(int argc, char** argv) {
 	// inializes everything
 	initAll();
 
+	// any arguments run batch mode instead of the menus
+	if (argc > 1) {
+		return runBatch(argc, argv);
+	}
+
 	// buffer for reading/writing
 	char buffer[BUFF_SIZE] = { '\0' };
 
@@ -20,6 +27,7 @@ int main(void) {
 		puts("\t(2) Machine Code to Assembly");
 		puts("\t(3) Quit");
 		puts("\t(4) Run Test Bench");
+		puts("\t(5) Run Benchmarks");
 		printf("\n> ");
 
 		memset(buffer, '\0', BUFF_SIZE);
@@ -38,6 +46,9 @@ int main(void) {
 		else if (strcmp(buffer, "4") == 0) {
 			run_tests();
 		}
+		else if (strcmp(buffer, "5") == 0) {
+			run_benchmarks();
+		}
 	}
 	return 0;
 }
@@ -88,7 +99,7 @@ void assembly2machine(char* buff) {
 		parseAssem(buff);
 
 		// checks if there was an error, and encodes if there wasn't
-		if (state == NO_ERROR) {
+		if (default_ctx.status == NO_ERROR) {
 			encode();
 		}
 
@@ -155,7 +166,7 @@ void binary2assembly(char* buff) {
 		parseBin(buff);
 
 		// checks if there was an error, and decodes if there wasn't
-		if (state == NO_ERROR) {
+		if (default_ctx.status == NO_ERROR) {
 			decode();
 		}
 
@@ -187,7 +198,7 @@ void hex2assembly(char* buff) {
 		parseHex(buff);
 
 		// checks if there was an error, and decodes if there wasn't
-		if (state == NO_ERROR) {
+		if (default_ctx.status == NO_ERROR) {
 			decode();
 		}
 
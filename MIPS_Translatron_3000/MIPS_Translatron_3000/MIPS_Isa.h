@@ -0,0 +1,73 @@
+#ifndef _MIPS_ISA_H_
+#define _MIPS_ISA_H_
+
+/*----------------------------\
+		   Enums
+\----------------------------*/
+// how an instruction is picked out of a binary word
+typedef enum Isa_Format {
+	FORMAT_R,	// SPECIAL opcode, picked by the function code
+	FORMAT_I	// picked by the primary opcode
+} Isa_Format;
+
+// how the parameters of an instruction are written in assembly
+typedef enum Isa_Syntax {
+	SYNTAX_LIST,	// "OP a, b, c", every parameter is separated by a comma
+	SYNTAX_MEM,		// "OP rt, imm(rs)", the base register is in brackets
+	SYNTAX_SINGLE	// "OP a", one parameter and no commas
+} Isa_Syntax;
+
+// how the immediate field of an instruction is read
+typedef enum Isa_Sign {
+	IMM_NONE,		// there is no immediate field
+	IMM_UNSIGNED,	// zero extended, like ANDI and ORI
+	IMM_SIGNED,		// sign extended, like ADDI and the memory offsets
+	IMM_BRANCH		// sign extended count of words from the next instruction, a label can be given instead
+} Isa_Sign;
+
+
+/*----------------------------\
+		 Instruction Set
+\----------------------------*/
+/*
+	ISA_TABLE(X) is the one description of every supported instruction, in Op_Id order, as
+	X(name, spelling, format, opcode, funct, zeros, syntax, sign, operands...)
+
+	name		- the mnemonic, OP_<name> is its Op_Id
+	spelling	- the letters of the mnemonic as character constants in brackets, so the
+				  mnemonic hash can be built at compile time
+	format		- FORMAT_R or FORMAT_I
+	opcode		- the primary opcode, bits 31-26
+	funct		- the function code of FORMAT_R instructions, bits 5-0
+	zeros		- any other bits that must be zero for a word to decode as this instruction
+	syntax		- how the parameters are written, one of Isa_Syntax
+	sign		- how the immediate is read, one of Isa_Sign
+	operands	- each parameter in the order it is validated, as
+				  REG_OPND(param, field) or IMM_OPND(param, field, max, error) where
+				  param is 1 for PARAM1, field is a name from ISA_FIELDS, max is the largest
+				  value accepted and error is the state set when the parameter isn't an immediate
+
+	The Op_Id enum, the mnemonic lookup, the encoder and decoder tables and the formatter
+	all come from this table, so adding an instruction is adding a row
+*/
+#define ISA_TABLE(X) \
+	X(ADD,	('A', 'D', 'D'), FORMAT_R, 0x00, 0x20, 0, SYNTAX_LIST, IMM_NONE, REG_OPND(1, rd), REG_OPND(2, rs), REG_OPND(3, rt)) \
+	X(ADDI,	('A', 'D', 'D', 'I'), FORMAT_I, 0x08, 0x00, 0, SYNTAX_LIST, IMM_SIGNED, REG_OPND(1, rt), REG_OPND(2, rs), IMM_OPND(3, imm16, 0xFFFF, INVALID_PARAM)) \
+	X(AND,	('A', 'N', 'D'), FORMAT_R, 0x00, 0x24, 0, SYNTAX_LIST, IMM_NONE, REG_OPND(1, rd), REG_OPND(2, rs), REG_OPND(3, rt)) \
+	X(ANDI,	('A', 'N', 'D', 'I'), FORMAT_I, 0x0C, 0x00, 0, SYNTAX_LIST, IMM_UNSIGNED, REG_OPND(1, rt), REG_OPND(2, rs), IMM_OPND(3, imm16, 0xFFFF, INVALID_PARAM)) \
+	X(BEQ,	('B', 'E', 'Q'), FORMAT_I, 0x04, 0x00, 0, SYNTAX_LIST, IMM_BRANCH, REG_OPND(1, rs), REG_OPND(2, rt), IMM_OPND(3, imm16, 0xFFFF, INVALID_PARAM)) \
+	X(BNE,	('B', 'N', 'E'), FORMAT_I, 0x05, 0x00, 0, SYNTAX_LIST, IMM_BRANCH, REG_OPND(1, rs), REG_OPND(2, rt), IMM_OPND(3, imm16, 0xFFFF, INVALID_PARAM)) \
+	X(DIV,	('D', 'I', 'V'), FORMAT_R, 0x00, 0x1A, 0, SYNTAX_LIST, IMM_NONE, REG_OPND(1, rs), REG_OPND(2, rt)) \
+	X(LUI,	('L', 'U', 'I'), FORMAT_I, 0x0F, 0x00, 0, SYNTAX_LIST, IMM_UNSIGNED, REG_OPND(1, rt), IMM_OPND(2, imm16, 0xFFFF, INVALID_PARAM)) \
+	X(LW,	('L', 'W'), FORMAT_I, 0x23, 0x00, 0, SYNTAX_MEM, IMM_SIGNED, REG_OPND(1, rt), REG_OPND(3, rs), IMM_OPND(2, imm16, 0x7FFF, INVALID_IMMED)) \
+	X(MFHI,	('M', 'F', 'H', 'I'), FORMAT_R, 0x00, 0x10, FIELD_MASK(rs) | FIELD_MASK(rt) | FIELD_MASK(shamt), SYNTAX_SINGLE, IMM_NONE, REG_OPND(1, rd)) \
+	X(MFLO,	('M', 'F', 'L', 'O'), FORMAT_R, 0x00, 0x12, FIELD_MASK(rs) | FIELD_MASK(rt) | FIELD_MASK(shamt), SYNTAX_SINGLE, IMM_NONE, REG_OPND(1, rd)) \
+	X(MULT,	('M', 'U', 'L', 'T'), FORMAT_R, 0x00, 0x18, 0, SYNTAX_LIST, IMM_NONE, REG_OPND(1, rs), REG_OPND(2, rt)) \
+	X(OR,	('O', 'R'), FORMAT_R, 0x00, 0x25, 0, SYNTAX_LIST, IMM_NONE, REG_OPND(1, rd), REG_OPND(2, rs), REG_OPND(3, rt)) \
+	X(ORI,	('O', 'R', 'I'), FORMAT_I, 0x0D, 0x00, 0, SYNTAX_LIST, IMM_UNSIGNED, REG_OPND(1, rt), REG_OPND(2, rs), IMM_OPND(3, imm16, 0xFFFF, INVALID_PARAM)) \
+	X(SLT,	('S', 'L', 'T'), FORMAT_R, 0x00, 0x2A, 0, SYNTAX_LIST, IMM_NONE, REG_OPND(1, rd), REG_OPND(2, rs), REG_OPND(3, rt)) \
+	X(SLTI,	('S', 'L', 'T', 'I'), FORMAT_I, 0x0A, 0x00, 0, SYNTAX_LIST, IMM_SIGNED, REG_OPND(1, rt), REG_OPND(2, rs), IMM_OPND(3, imm16, 0xFFFF, INVALID_PARAM)) \
+	X(SUB,	('S', 'U', 'B'), FORMAT_R, 0x00, 0x22, 0, SYNTAX_LIST, IMM_NONE, REG_OPND(1, rd), REG_OPND(2, rs), REG_OPND(3, rt)) \
+	X(SW,	('S', 'W'), FORMAT_I, 0x2B, 0x00, 0, SYNTAX_MEM, IMM_SIGNED, REG_OPND(1, rt), IMM_OPND(2, imm16, 0xFFFF, INVALID_PARAM), REG_OPND(3, rs))
+
+#endif
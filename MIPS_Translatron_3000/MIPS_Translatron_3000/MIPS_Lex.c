@@ -0,0 +1,185 @@
+#include "MIPS_Lex.h"
+
+/*----------------------------\
+		 Lookup Tables
+\----------------------------*/
+// classes shared by groups of characters
+#define DIGIT (CHAR_DIGIT | CHAR_HEX)
+#define HEX_LETTER (CHAR_ALPHA | CHAR_HEX)
+#define LETTER CHAR_ALPHA
+
+// CHAR_ class bits of each character, anything not listed is in no class
+const uint8_t char_class[256] = {
+	['\t'] = CHAR_BLANK, [' '] = CHAR_BLANK, ['\n'] = CHAR_NEWLINE, ['\r'] = CHAR_NEWLINE,
+	['_'] = CHAR_SYMBOL, ['.'] = CHAR_SYMBOL,
+	['0'] = DIGIT, ['1'] = DIGIT, ['2'] = DIGIT, ['3'] = DIGIT, ['4'] = DIGIT, ['5'] = DIGIT, ['6'] = DIGIT, ['7'] = DIGIT, ['8'] = DIGIT, ['9'] = DIGIT,
+	['A'] = HEX_LETTER, ['B'] = HEX_LETTER, ['C'] = HEX_LETTER, ['D'] = HEX_LETTER, ['E'] = HEX_LETTER, ['F'] = HEX_LETTER,
+	['G'] = LETTER, ['H'] = LETTER, ['I'] = LETTER, ['J'] = LETTER, ['K'] = LETTER, ['L'] = LETTER, ['M'] = LETTER, ['N'] = LETTER, ['O'] = LETTER, ['P'] = LETTER,
+	['Q'] = LETTER, ['R'] = LETTER, ['S'] = LETTER, ['T'] = LETTER, ['U'] = LETTER, ['V'] = LETTER, ['W'] = LETTER, ['X'] = LETTER, ['Y'] = LETTER, ['Z'] = LETTER,
+	['a'] = HEX_LETTER, ['b'] = HEX_LETTER, ['c'] = HEX_LETTER, ['d'] = HEX_LETTER, ['e'] = HEX_LETTER, ['f'] = HEX_LETTER,
+	['g'] = LETTER, ['h'] = LETTER, ['i'] = LETTER, ['j'] = LETTER, ['k'] = LETTER, ['l'] = LETTER, ['m'] = LETTER, ['n'] = LETTER, ['o'] = LETTER, ['p'] = LETTER,
+	['q'] = LETTER, ['r'] = LETTER, ['s'] = LETTER, ['t'] = LETTER, ['u'] = LETTER, ['v'] = LETTER, ['w'] = LETTER, ['x'] = LETTER, ['y'] = LETTER, ['z'] = LETTER
+};
+
+// value of each hex digit plus one, anything that isn't a hex digit is 0
+const uint8_t hex_values[256] = {
+	['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5, ['5'] = 6, ['6'] = 7, ['7'] = 8, ['8'] = 9, ['9'] = 10,
+	['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+	['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16
+};
+
+
+/*----------------------------\
+		 SWAR Digits
+\----------------------------*/
+// a byte of '0' in every lane, used to pad short runs with leading zeros
+#define ZERO_DIGITS 0x3030303030303030ull
+
+/*
+	Purpose: loads up to 8 digits into a word, first digit in the lowest byte, padded in front
+			 with '0' so the digits always end in the highest byte
+	Params: const char* digits - the first digit
+			size_t count - the number of digits, 1 to 8
+	Return: uint64_t - the 8 digit characters
+*/
+static inline uint64_t loadDigits(const char* digits, size_t count) {
+	uint64_t chunk = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		chunk |= (uint64_t)(uint8_t)digits[i] << (8 * i);
+	}
+
+	if (count == 8) {
+		return chunk;
+	}
+
+	return (chunk << (8 * (8 - count))) | (ZERO_DIGITS >> (8 * count));
+}
+
+/*
+	Purpose: converts 8 decimal digits to their value with 3 multiplies instead of 8
+	Params: uint64_t chunk - the digits from loadDigits
+	Return: uint32_t - the value, at most 99999999
+*/
+static inline uint32_t decimal8(uint64_t chunk) {
+	// each step joins neighbouring lanes, 1 digit to 2, 2 to 4 and 4 to 8
+	chunk = ((chunk & 0x0F0F0F0F0F0F0F0Full) * ((10 << 8) + 1)) >> 8;
+	chunk = ((chunk & 0x00FF00FF00FF00FFull) * ((100ull << 16) + 1)) >> 16;
+	return (uint32_t)(((chunk & 0x0000FFFF0000FFFFull) * ((10000ull << 32) + 1)) >> 32);
+}
+
+/*
+	Purpose: converts 8 hex digits to their value without a branch per digit
+	Params: uint64_t chunk - the digits from loadDigits
+	Return: uint32_t - the value
+*/
+static inline uint32_t hex8(uint64_t chunk) {
+	// letters have bit 6 set, so their low nibble needs 9 added, 'A' (0x41) becomes 10
+	chunk = (chunk & 0x0F0F0F0F0F0F0F0Full) + (((chunk >> 6) & 0x0101010101010101ull) * 9);
+
+	// joins neighbouring lanes, 1 nibble to 2, 2 to 4 and 4 to 8, the first digit is the highest
+	chunk = ((chunk & 0x000F000F000F000Full) << 4) | ((chunk >> 8) & 0x000F000F000F000Full);
+	chunk = ((chunk & 0x000000FF000000FFull) << 8) | ((chunk >> 16) & 0x000000FF000000FFull);
+	return (uint32_t)(((chunk & 0xFFFFull) << 16) | ((chunk >> 32) & 0xFFFFull));
+}
+
+/*
+	Purpose: converts 8 binary digits to their value with one multiply
+	Params: uint64_t chunk - the digits from loadDigits
+	Return: uint32_t - the value, at most 255
+*/
+static inline uint32_t binary8(uint64_t chunk) {
+	// the multiply moves the bit of each lane into the top byte, the first digit highest
+	return (uint32_t)(((chunk & 0x0101010101010101ull) * 0x8040201008040201ull) >> 56);
+}
+
+
+/*----------------------------\
+		   Numbers
+\----------------------------*/
+/*
+	Purpose: reads a number as decimal, hex after 0x or binary after 0b, with an optional
+			 leading '-', a prefix with no digits after it reads as 0 but a lone '-' is
+			 not a number
+	Params: const char* pos - the first character of the number
+			const char* end - one past the last character of the text
+			uint32_t* value - filled with the number, negative numbers as two's complement
+	Return: const char* - the ptr to after the number, NULL if the number doesn't fit in 32 bits
+			or is a '-' with no number after it
+*/
+const char* lexNumber(const char* pos, const char* end, uint32_t* value) {
+	int negative = 0;
+	if ((pos < end) && (*pos == '-')) {
+		negative = 1;
+		pos++;
+	}
+	const char* number = pos;
+
+	// picks the base from the prefix
+	uint32_t base_class = CHAR_DIGIT;
+	uint32_t base_digits = 10;
+	if ((end - pos >= 2) && (pos[0] == '0') && ((pos[1] | 0x20) == 'x')) {
+		base_class = CHAR_HEX;
+		base_digits = 8;
+		pos += 2;
+	}
+	else if ((end - pos >= 2) && (pos[0] == '0') && ((pos[1] | 0x20) == 'b')) {
+		base_class = 0;
+		base_digits = 32;
+		pos += 2;
+	}
+
+	// finds the run of digits, leading zeros don't count toward the limit
+	const char* start = pos;
+	if (base_class == 0) {
+		while ((pos < end) && ((*pos == '0') || (*pos == '1'))) { pos++; }
+	}
+	else {
+		while ((pos < end) && charIs(*pos, base_class)) { pos++; }
+	}
+	// a '-' has to be followed by a number, "-0x" is still -0 like "0x" is 0
+	if (negative && (pos == number)) {
+		return NULL;
+	}
+
+	const char* digits = start;
+	while ((digits < pos) && (*digits == '0')) { digits++; }
+
+	size_t count = (size_t)(pos - digits);
+	if (count > base_digits) {
+		return NULL;
+	}
+
+	uint64_t num = 0;
+	if (base_class == CHAR_HEX) {
+		num = (count > 0) ? hex8(loadDigits(digits, count)) : 0;
+	}
+	else if (base_class == CHAR_DIGIT) {
+		// up to 2 leading digits, then a block of 8
+		size_t head = (count > 8) ? count - 8 : 0;
+		if (head > 0) {
+			num = (uint64_t)decimal8(loadDigits(digits, head)) * 100000000;
+		}
+		if (count > head) {
+			num += decimal8(loadDigits(digits + head, count - head));
+		}
+	}
+	else {
+		// 8 bits at a time from the front, a short group first so the rest are whole
+		size_t group = count % 8;
+		if (group == 0) {
+			group = 8;
+		}
+		for (size_t i = 0; i < count; i += group, group = 8) {
+			num = (num << group) | binary8(loadDigits(digits + i, group));
+		}
+	}
+
+	// negative numbers go down to -2^31
+	if ((num > UINT32_MAX) || (negative && (num > 0x80000000u))) {
+		return NULL;
+	}
+
+	*value = negative ? (uint32_t)(0 - (uint32_t)num) : (uint32_t)num;
+	return pos;
+}
@@ -0,0 +1,86 @@
+#ifndef _MIPS_LEX_H_
+#define _MIPS_LEX_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+	character classes in char_class, a character can be in several, these replace the
+	ctype functions so reading text never depends on the locale
+*/
+#define CHAR_DIGIT (1u << 0)	// '0' to '9'
+#define CHAR_HEX (1u << 1)		// '0' to '9', 'a' to 'f' and 'A' to 'F'
+#define CHAR_ALPHA (1u << 2)	// 'a' to 'z' and 'A' to 'Z'
+#define CHAR_BLANK (1u << 3)	// space and tab
+#define CHAR_NEWLINE (1u << 4)	// '\n' and '\r'
+#define CHAR_SYMBOL (1u << 5)	// '_' and '.', which labels can have as well as letters
+#define CHAR_ALNUM (CHAR_DIGIT | CHAR_ALPHA)
+
+/*----------------------------\
+		 Lookup Tables
+\----------------------------*/
+// CHAR_ class bits of each character
+extern const uint8_t char_class[256];
+
+// value of each hex digit plus one, anything that isn't a hex digit is 0
+extern const uint8_t hex_values[256];
+
+
+/*----------------------------\
+		Classification
+\----------------------------*/
+/*
+	Purpose: checks if a character is in any of a set of classes
+	Params: char c - the character to check
+			uint32_t classes - CHAR_ class bits or'd together
+	Return: int - nonzero if the character is in one of the classes, 0 otherwise
+*/
+static inline int charIs(char c, uint32_t classes) {
+	return char_class[(uint8_t)c] & classes;
+}
+
+/*
+	Purpose: gets the value of a hex digit, check it with CHAR_HEX first
+	Params: char c - the digit
+	Return: uint32_t - the value from 0 to 15
+*/
+static inline uint32_t hexValue(char c) {
+	return (uint32_t)hex_values[(uint8_t)c] - 1;
+}
+
+
+/*----------------------------\
+		   Numbers
+\----------------------------*/
+/*
+	Purpose: reads a number as decimal, hex after 0x or binary after 0b, with an optional
+			 leading '-', a prefix with no digits after it reads as 0 but a lone '-' is
+			 not a number, up to 8 digits are converted at a time within a 64 bit word
+	Params: const char* pos - the first character of the number
+			const char* end - one past the last character of the text
+			uint32_t* value - filled with the number, negative numbers as two's complement
+	Return: const char* - the ptr to after the number, NULL if the number doesn't fit in 32 bits
+			or is a '-' with no number after it
+*/
+const char* lexNumber(const char* pos, const char* end, uint32_t* value);
+
+
+/*----------------------------\
+		   Labels
+\----------------------------*/
+/*
+	Purpose: reads a label name, a letter, '_' or '.' followed by any of those or digits
+	Params: const char* pos - the first character of the name
+			const char* end - one past the last character of the text
+	Return: const char* - the position after the name, pos if there isn't a name there
+*/
+static inline const char* lexLabel(const char* pos, const char* end) {
+	if ((pos >= end) || !charIs(*pos, CHAR_ALPHA | CHAR_SYMBOL)) {
+		return pos;
+	}
+
+	do { pos++; } while ((pos < end) && charIs(*pos, CHAR_ALNUM | CHAR_SYMBOL));
+	return pos;
+}
+
+#endif
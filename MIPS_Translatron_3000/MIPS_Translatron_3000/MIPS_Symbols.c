@@ -0,0 +1,217 @@
+#include "MIPS_Symbols.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------\
+		 Symbol Lists
+\----------------------------*/
+/*
+	Purpose: hashes a label name for a symbol table, FNV-1a
+	Params: const char* name - the name, does not need to be terminated
+			uint32_t len - the number of characters in the name
+	Return: uint32_t - the hash
+*/
+uint32_t symbolHash(const char* name, uint32_t len) {
+	uint32_t hash = 2166136261u;
+
+	for (uint32_t i = 0; i < len; i++) {
+		hash ^= (uint8_t)name[i];
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/*
+	Purpose: copies a label name into the arena of a list
+	Params: Symbol_List* list - the list that owns the arena
+			const char* name - the name, does not need to be terminated
+			uint32_t len - the number of characters in the name
+	Return: const char* - the copy, or NULL if a new block couldn't be allocated
+*/
+static const char* copyName(Symbol_List* list, const char* name, uint32_t len) {
+	Symbol_Block* block = list->arena;
+
+	// names are never split across blocks, one longer than a block gets a block to itself
+	if ((block == NULL) || (block->size - block->used < len)) {
+		size_t size = (len > SYMBOL_BLOCK_SIZE) ? len : SYMBOL_BLOCK_SIZE;
+
+		block = malloc(sizeof(Symbol_Block) + size);
+		if (block == NULL) {
+			return NULL;
+		}
+
+		block->next = list->arena;
+		block->used = 0;
+		block->size = size;
+		list->arena = block;
+	}
+
+	char* copy = block->data + block->used;
+	memcpy(copy, name, len);
+	block->used += len;
+
+	return copy;
+}
+
+/*
+	Purpose: adds a label definition to the end of a list, copying its name into the list's arena
+	Params: Symbol_List* list - the list to add to, zeroed before the first label
+			const char* name - the name, does not need to be terminated
+			uint32_t len - the number of characters in the name
+			uint32_t address - the byte address of the word the label is on
+			uint32_t line - the line the label is defined on
+	Return: int - 0 for no error, 1 if the list or the name couldn't be allocated
+*/
+int listSymbol(Symbol_List* list, const char* name, uint32_t len, uint32_t address, uint32_t line) {
+	if (list->count == list->capacity) {
+		uint32_t capacity = (list->capacity == 0) ? 64 : list->capacity * 2;
+		Symbol* bigger = realloc(list->symbols, (size_t)capacity * sizeof(Symbol));
+
+		if (bigger == NULL) {
+			return 1;
+		}
+
+		list->symbols = bigger;
+		list->capacity = capacity;
+	}
+
+	const char* copy = copyName(list, name, len);
+	if (copy == NULL) {
+		return 1;
+	}
+
+	Symbol* symbol = &list->symbols[list->count++];
+	symbol->name = copy;
+	symbol->len = len;
+	symbol->hash = symbolHash(name, len);
+	symbol->address = address;
+	symbol->line = line;
+
+	return 0;
+}
+
+/*
+	Purpose: frees the labels and every arena block of a list
+	Params: Symbol_List* list - the list to free
+	Return: none
+*/
+void freeSymbolList(Symbol_List* list) {
+	while (list->arena != NULL) {
+		Symbol_Block* next = list->arena->next;
+		free(list->arena);
+		list->arena = next;
+	}
+
+	free(list->symbols);
+	list->symbols = NULL;
+	list->count = 0;
+	list->capacity = 0;
+}
+
+
+/*----------------------------\
+		 Symbol Table
+\----------------------------*/
+/*
+	Purpose: checks if a label has a name
+	Params: const Symbol* symbol - the label to check
+			const char* name - the name, does not need to be terminated
+			uint32_t len - the number of characters in the name
+			uint32_t hash - symbolHash of the name
+	Return: int - 1 if the names are the same, 0 if they aren't
+*/
+static inline int sameName(const Symbol* symbol, const char* name, uint32_t len, uint32_t hash) {
+	return (symbol->hash == hash) && (symbol->len == len) && (memcmp(symbol->name, name, len) == 0);
+}
+
+/*
+	Purpose: sets up an empty symbol table
+	Params: Symbol_Table* table - the table to set up
+			uint32_t count - the most labels that will be merged into it
+	Return: int - 0 for no error, 1 if the slots couldn't be allocated
+*/
+int initSymbols(Symbol_Table* table, uint32_t count) {
+	// rounds up to a power of two with room for twice the labels, so probes stay short
+	uint32_t slots = SYMBOL_TABLE_SIZE;
+	while ((slots / 2 < count) && (slots < (1u << 31))) { slots *= 2; }
+
+	table->slots = malloc((size_t)slots * sizeof(*table->slots));
+	table->capacity = (table->slots == NULL) ? 0 : slots;
+
+	for (uint32_t i = 0; i < table->capacity; i++) {
+		atomic_init(&table->slots[i], NULL);
+	}
+
+	return (table->slots == NULL) ? 1 : 0;
+}
+
+/*
+	Purpose: merges a label into a symbol table, safe to call from many threads at once, the
+			 label isn't copied so its list has to outlive the table
+	Params: Symbol_Table* table - the table to merge into
+			const Symbol* symbol - the label
+	Return: Symbol_Result - SYMBOL_ADDED, or why the label isn't in the table
+*/
+Symbol_Result mergeSymbol(Symbol_Table* table, const Symbol* symbol) {
+	uint32_t mask = table->capacity - 1;
+	uint32_t slot = symbol->hash & mask;
+
+	for (uint32_t probes = 0; probes < table->capacity; probes++) {
+		const Symbol* current = atomic_load_explicit(&table->slots[slot], memory_order_acquire);
+
+		// a failed swap reloads the slot, so it is checked again until the label is placed or the slot holds another name
+		while ((current == NULL) || sameName(current, symbol->name, symbol->len, symbol->hash)) {
+			// the earliest definition of a name wins, whichever thread gets there first
+			if ((current != NULL) && (current->line <= symbol->line)) {
+				return SYMBOL_DUPLICATE;
+			}
+
+			if (atomic_compare_exchange_weak_explicit(&table->slots[slot], &current, symbol, memory_order_acq_rel, memory_order_acquire)) {
+				return SYMBOL_ADDED;
+			}
+		}
+
+		slot = (slot + 1) & mask;
+	}
+
+	return SYMBOL_NO_MEMORY;
+}
+
+/*
+	Purpose: looks up a label in a symbol table
+	Params: const Symbol_Table* table - the table to look in
+			const char* name - the name, does not need to be terminated
+			uint32_t len - the number of characters in the name
+	Return: const Symbol* - the earliest definition of the label, or NULL if it isn't in the table
+*/
+const Symbol* findSymbol(const Symbol_Table* table, const char* name, uint32_t len) {
+	uint32_t hash = symbolHash(name, len);
+	uint32_t mask = table->capacity - 1;
+	uint32_t slot = hash & mask;
+
+	// the table is never more than half full, so an empty slot always ends the probe
+	for (uint32_t probes = 0; probes < table->capacity; probes++) {
+		const Symbol* symbol = atomic_load_explicit(&table->slots[slot], memory_order_acquire);
+
+		if ((symbol == NULL) || sameName(symbol, name, len, hash)) {
+			return symbol;
+		}
+
+		slot = (slot + 1) & mask;
+	}
+
+	return NULL;
+}
+
+/*
+	Purpose: frees the slots of a symbol table, the labels belong to their lists
+	Params: Symbol_Table* table - the table to free
+	Return: none
+*/
+void freeSymbols(Symbol_Table* table) {
+	free((void*)table->slots);
+	table->slots = NULL;
+	table->capacity = 0;
+}
@@ -0,0 +1,130 @@
+#ifndef _MIPS_SYMBOLS_H_
+#define _MIPS_SYMBOLS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+// fewest slots a symbol table has, always a power of two
+#define SYMBOL_TABLE_SIZE 1024
+
+// size of each block of the arena label names are copied into
+#define SYMBOL_BLOCK_SIZE (64 << 10)
+
+/*----------------------------\
+		   Enums
+\----------------------------*/
+// results of merging a label into a symbol table
+typedef enum Symbol_Result {
+	SYMBOL_ADDED,		// the label is in the table, it may have replaced a later definition of the same name
+	SYMBOL_DUPLICATE,	// an earlier definition of the same name is in the table
+	SYMBOL_NO_MEMORY	// the table is full
+} Symbol_Result;
+
+
+/*----------------------------\
+		   Data Types
+\----------------------------*/
+// struct for one label definition
+typedef struct {
+	const char* name;	// the name in the arena of its list, not terminated
+	uint32_t len;		// the number of characters in the name
+	uint32_t hash;		// symbolHash of the name
+	uint32_t address;	// the byte address of the word the label is on
+	uint32_t line;		// the line the label is defined on, the earliest line wins when a name is defined twice
+} Symbol;
+
+// a block of the arena label names are copied into
+typedef struct Symbol_Block {
+	struct Symbol_Block* next;	// the block filled before this one
+	size_t used;				// the number of bytes of data taken
+	size_t size;				// the number of bytes of data
+	char data[];
+} Symbol_Block;
+
+// struct for the labels one thread collects, in the order they are defined
+typedef struct {
+	Symbol* symbols;		// count labels
+	uint32_t count;
+	uint32_t capacity;
+	Symbol_Block* arena;	// the block names are being copied into, NULL before the first
+} Symbol_List;
+
+/*
+	struct for an open addressing table of labels, probed linearly, sized up front for every
+	label so it never grows, the slots point at labels in lists and are claimed with a compare
+	and swap so many threads can merge their lists into it at once without locks
+*/
+typedef struct {
+	_Atomic(const Symbol*)* slots;	// capacity slots, NULL for an empty slot
+	uint32_t capacity;				// a power of two, at least twice the labels
+} Symbol_Table;
+
+
+/*----------------------------\
+		 Symbol Lists
+\----------------------------*/
+/*
+	Purpose: hashes a label name for a symbol table, FNV-1a
+	Params: const char* name - the name, does not need to be terminated
+			uint32_t len - the number of characters in the name
+	Return: uint32_t - the hash
+*/
+uint32_t symbolHash(const char* name, uint32_t len);
+
+/*
+	Purpose: adds a label definition to the end of a list, copying its name into the list's arena
+	Params: Symbol_List* list - the list to add to, zeroed before the first label
+			const char* name - the name, does not need to be terminated
+			uint32_t len - the number of characters in the name
+			uint32_t address - the byte address of the word the label is on
+			uint32_t line - the line the label is defined on
+	Return: int - 0 for no error, 1 if the list or the name couldn't be allocated
+*/
+int listSymbol(Symbol_List* list, const char* name, uint32_t len, uint32_t address, uint32_t line);
+
+/*
+	Purpose: frees the labels and every arena block of a list
+	Params: Symbol_List* list - the list to free
+	Return: none
+*/
+void freeSymbolList(Symbol_List* list);
+
+
+/*----------------------------\
+		 Symbol Table
+\----------------------------*/
+/*
+	Purpose: sets up an empty symbol table
+	Params: Symbol_Table* table - the table to set up
+			uint32_t count - the most labels that will be merged into it
+	Return: int - 0 for no error, 1 if the slots couldn't be allocated
+*/
+int initSymbols(Symbol_Table* table, uint32_t count);
+
+/*
+	Purpose: merges a label into a symbol table, safe to call from many threads at once, the
+			 label isn't copied so its list has to outlive the table
+	Params: Symbol_Table* table - the table to merge into
+			const Symbol* symbol - the label
+	Return: Symbol_Result - SYMBOL_ADDED, or why the label isn't in the table
+*/
+Symbol_Result mergeSymbol(Symbol_Table* table, const Symbol* symbol);
+
+/*
+	Purpose: looks up a label in a symbol table
+	Params: const Symbol_Table* table - the table to look in
+			const char* name - the name, does not need to be terminated
+			uint32_t len - the number of characters in the name
+	Return: const Symbol* - the earliest definition of the label, or NULL if it isn't in the table
+*/
+const Symbol* findSymbol(const Symbol_Table* table, const char* name, uint32_t len);
+
+/*
+	Purpose: frees the slots of a symbol table, the labels belong to their lists
+	Params: Symbol_Table* table - the table to free
+	Return: none
+*/
+void freeSymbols(Symbol_Table* table);
+
+#endif
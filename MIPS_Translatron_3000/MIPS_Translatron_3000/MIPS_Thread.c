@@ -0,0 +1,325 @@
+#include "MIPS_Thread.h"
+
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// what the threads of a pool sleep on until they are woken
+#ifdef _WIN32
+typedef CONDITION_VARIABLE Pool_Signal;
+#else
+typedef pthread_cond_t Pool_Signal;
+#endif
+
+// the threads of a pool and the round of work they share, every field after the threads is guarded by the lock
+struct Thread_Pool {
+#ifdef _WIN32
+	CRITICAL_SECTION lock;
+	HANDLE threads[MAX_THREADS];
+#else
+	pthread_mutex_t lock;
+	pthread_t threads[MAX_THREADS];
+#endif
+	uint32_t thread_count;	// the number of threads that were started
+	Pool_Signal work_ready;	// woken when a round is handed out or the pool is stopping
+	Pool_Signal work_done;	// woken when the last entry of a round finishes
+	Thread_Work work;		// the function of the round
+	char* args;				// the arguments of the round
+	size_t arg_size;
+	uint32_t count;			// the number of entries in the round
+	uint32_t next;			// the next entry to hand out
+	uint32_t pending;		// the entries that haven't finished
+	int stopping;			// set when the threads should return
+};
+
+/*----------------------------\
+		   Threads
+\----------------------------*/
+/*
+	Purpose: finds how many threads the machine can run at once
+	Params: none
+	Return: uint32_t - the number of processors, from 1 to MAX_THREADS
+*/
+uint32_t threadCount(void) {
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	long count = (long)info.dwNumberOfProcessors;
+#else
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+	if (count < 1) {
+		return 1;
+	}
+
+	return (count > MAX_THREADS) ? MAX_THREADS : (uint32_t)count;
+}
+
+
+/*----------------------------\
+		 Thread Pool
+\----------------------------*/
+/*
+	Purpose: takes the lock of a pool
+	Params: Thread_Pool* pool - the pool to lock
+	Return: none
+*/
+static void lockPool(Thread_Pool* pool) {
+#ifdef _WIN32
+	EnterCriticalSection(&pool->lock);
+#else
+	pthread_mutex_lock(&pool->lock);
+#endif
+}
+
+/*
+	Purpose: gives back the lock of a pool
+	Params: Thread_Pool* pool - the pool to unlock
+	Return: none
+*/
+static void unlockPool(Thread_Pool* pool) {
+#ifdef _WIN32
+	LeaveCriticalSection(&pool->lock);
+#else
+	pthread_mutex_unlock(&pool->lock);
+#endif
+}
+
+/*
+	Purpose: gives back the lock of a pool until a signal is woken, then takes it again, the
+			 caller checks what it was waiting for again since a wake can be spurious
+	Params: Thread_Pool* pool - the pool, locked by the caller
+			Pool_Signal* signal - the signal to sleep on
+	Return: none
+*/
+static void waitSignal(Thread_Pool* pool, Pool_Signal* signal) {
+#ifdef _WIN32
+	SleepConditionVariableCS(signal, &pool->lock, INFINITE);
+#else
+	pthread_cond_wait(signal, &pool->lock);
+#endif
+}
+
+/*
+	Purpose: wakes every thread sleeping on a signal
+	Params: Pool_Signal* signal - the signal to wake
+	Return: none
+*/
+static void wakeSignal(Pool_Signal* signal) {
+#ifdef _WIN32
+	WakeAllConditionVariable(signal);
+#else
+	pthread_cond_broadcast(signal);
+#endif
+}
+
+/*
+	Purpose: runs entries of the round until none are left to hand out, the lock is given back
+			 while each one runs
+	Params: Thread_Pool* pool - the pool, locked by the caller
+	Return: none
+*/
+static void runEntries(Thread_Pool* pool) {
+	while (pool->next < pool->count) {
+		Thread_Work work = pool->work;
+		void* arg = pool->args + ((size_t)pool->next * pool->arg_size);
+		pool->next++;
+
+		unlockPool(pool);
+		work(arg);
+		lockPool(pool);
+
+		if (--pool->pending == 0) {
+			wakeSignal(&pool->work_done);
+		}
+	}
+}
+
+/*
+	Purpose: the entry point of every thread of a pool, runs each round until the pool stops
+	Params: void* pool - the Thread_Pool the thread belongs to
+	Return: none
+*/
+#ifdef _WIN32
+static DWORD WINAPI poolMain(LPVOID arg) {
+#else
+static void* poolMain(void* arg) {
+#endif
+	Thread_Pool* pool = arg;
+
+	lockPool(pool);
+	while (1) {
+		runEntries(pool);
+
+		if (pool->stopping) {
+			break;
+		}
+		waitSignal(pool, &pool->work_ready);
+	}
+	unlockPool(pool);
+
+#ifdef _WIN32
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+/*
+	Purpose: starts the threads of a pool, which wait for work until the pool is stopped
+	Params: uint32_t count - the number of threads to start, at most MAX_THREADS
+	Return: Thread_Pool* - the pool, or NULL if it couldn't be allocated, a NULL pool runs its
+			work on the calling thread
+*/
+Thread_Pool* startPool(uint32_t count) {
+	Thread_Pool* pool = calloc(1, sizeof(Thread_Pool));
+	if (pool == NULL) {
+		return NULL;
+	}
+
+#ifdef _WIN32
+	InitializeCriticalSection(&pool->lock);
+	InitializeConditionVariable(&pool->work_ready);
+	InitializeConditionVariable(&pool->work_done);
+#else
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->work_ready, NULL);
+	pthread_cond_init(&pool->work_done, NULL);
+#endif
+
+	if (count > MAX_THREADS) {
+		count = MAX_THREADS;
+	}
+
+	// the pool keeps the threads that could be started, with none the calling thread does the work
+	while (pool->thread_count < count) {
+#ifdef _WIN32
+		HANDLE thread = CreateThread(NULL, 0, poolMain, pool, 0, NULL);
+		if (thread == NULL) {
+			break;
+		}
+		pool->threads[pool->thread_count++] = thread;
+#else
+		if (pthread_create(&pool->threads[pool->thread_count], NULL, poolMain, pool) != 0) {
+			break;
+		}
+		pool->thread_count++;
+#endif
+	}
+
+	return pool;
+}
+
+/*
+	Purpose: hands every entry of an argument array to the threads of a pool and returns without
+			 waiting, so the calling thread can do other work while they run
+	Params: Thread_Pool* pool - the pool to run on, the work of the last submitPool has to be waited for
+			Thread_Work work - the function to run
+			void* args - the array of arguments, entry i is passed to the i-th call
+			size_t arg_size - the size of one entry
+			uint32_t count - the number of entries
+	Return: none
+*/
+void submitPool(Thread_Pool* pool, Thread_Work work, void* args, size_t arg_size, uint32_t count) {
+	// without threads the entries are run before returning
+	if ((pool == NULL) || (pool->thread_count == 0)) {
+		for (uint32_t i = 0; i < count; i++) {
+			work((char*)args + (i * arg_size));
+		}
+		return;
+	}
+
+	lockPool(pool);
+	pool->work = work;
+	pool->args = args;
+	pool->arg_size = arg_size;
+	pool->count = count;
+	pool->next = 0;
+	pool->pending = count;
+	wakeSignal(&pool->work_ready);
+	unlockPool(pool);
+}
+
+/*
+	Purpose: waits for every entry handed to a pool by the last submitPool
+	Params: Thread_Pool* pool - the pool to wait for
+	Return: none
+*/
+void waitPool(Thread_Pool* pool) {
+	if (pool == NULL) {
+		return;
+	}
+
+	lockPool(pool);
+	while (pool->pending > 0) {
+		waitSignal(pool, &pool->work_done);
+	}
+	unlockPool(pool);
+}
+
+/*
+	Purpose: runs a function on every entry of an argument array with the threads of a pool and
+			 waits for all of them, the calling thread runs entries too
+	Params: Thread_Pool* pool - the pool to run on
+			Thread_Work work - the function to run
+			void* args - the array of arguments, entry i is passed to the i-th call
+			size_t arg_size - the size of one entry
+			uint32_t count - the number of entries
+	Return: none
+*/
+void runPool(Thread_Pool* pool, Thread_Work work, void* args, size_t arg_size, uint32_t count) {
+	submitPool(pool, work, args, arg_size, count);
+
+	if ((pool == NULL) || (pool->thread_count == 0)) {
+		return;
+	}
+
+	// the calling thread takes entries like the others instead of only waiting
+	lockPool(pool);
+	runEntries(pool);
+	while (pool->pending > 0) {
+		waitSignal(pool, &pool->work_done);
+	}
+	unlockPool(pool);
+}
+
+/*
+	Purpose: stops and waits for the threads of a pool, then frees it
+	Params: Thread_Pool* pool - the pool to stop, can be NULL
+	Return: none
+*/
+void stopPool(Thread_Pool* pool) {
+	if (pool == NULL) {
+		return;
+	}
+
+	lockPool(pool);
+	pool->stopping = 1;
+	wakeSignal(&pool->work_ready);
+	unlockPool(pool);
+
+	for (uint32_t i = 0; i < pool->thread_count; i++) {
+#ifdef _WIN32
+		WaitForSingleObject(pool->threads[i], INFINITE);
+		CloseHandle(pool->threads[i]);
+#else
+		pthread_join(pool->threads[i], NULL);
+#endif
+	}
+
+#ifdef _WIN32
+	DeleteCriticalSection(&pool->lock);
+#else
+	pthread_cond_destroy(&pool->work_done);
+	pthread_cond_destroy(&pool->work_ready);
+	pthread_mutex_destroy(&pool->lock);
+#endif
+
+	free(pool);
+}
@@ -0,0 +1,76 @@
+#ifndef _MIPS_THREAD_H_
+#define _MIPS_THREAD_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// most threads a pool will start
+#define MAX_THREADS 64
+
+// function run by each thread, given its own entry of the argument array
+typedef void (*Thread_Work)(void* arg);
+
+// a set of threads started once and handed work in rounds, the layout is kept in MIPS_Thread.c
+typedef struct Thread_Pool Thread_Pool;
+
+/*----------------------------\
+		   Threads
+\----------------------------*/
+/*
+	Purpose: finds how many threads the machine can run at once
+	Params: none
+	Return: uint32_t - the number of processors, from 1 to MAX_THREADS
+*/
+uint32_t threadCount(void);
+
+
+/*----------------------------\
+		 Thread Pool
+\----------------------------*/
+/*
+	Purpose: starts the threads of a pool, which wait for work until the pool is stopped
+	Params: uint32_t count - the number of threads to start, at most MAX_THREADS
+	Return: Thread_Pool* - the pool, or NULL if it couldn't be allocated, a NULL pool runs its
+			work on the calling thread
+*/
+Thread_Pool* startPool(uint32_t count);
+
+/*
+	Purpose: hands every entry of an argument array to the threads of a pool and returns without
+			 waiting, so the calling thread can do other work while they run
+	Params: Thread_Pool* pool - the pool to run on, the work of the last submitPool has to be waited for
+			Thread_Work work - the function to run
+			void* args - the array of arguments, entry i is passed to the i-th call
+			size_t arg_size - the size of one entry
+			uint32_t count - the number of entries
+	Return: none
+*/
+void submitPool(Thread_Pool* pool, Thread_Work work, void* args, size_t arg_size, uint32_t count);
+
+/*
+	Purpose: waits for every entry handed to a pool by the last submitPool
+	Params: Thread_Pool* pool - the pool to wait for
+	Return: none
+*/
+void waitPool(Thread_Pool* pool);
+
+/*
+	Purpose: runs a function on every entry of an argument array with the threads of a pool and
+			 waits for all of them, the calling thread runs entries too
+	Params: Thread_Pool* pool - the pool to run on
+			Thread_Work work - the function to run
+			void* args - the array of arguments, entry i is passed to the i-th call
+			size_t arg_size - the size of one entry
+			uint32_t count - the number of entries
+	Return: none
+*/
+void runPool(Thread_Pool* pool, Thread_Work work, void* args, size_t arg_size, uint32_t count);
+
+/*
+	Purpose: stops and waits for the threads of a pool, then frees it
+	Params: Thread_Pool* pool - the pool to stop, can be NULL
+	Return: none
+*/
+void stopPool(Thread_Pool* pool);
+
+#endif
@@ -0,0 +1,413 @@
+/*
+ * Date: 10/17/2026
+ * ByteForge Systems
+ * MIPS-Translatron 3000
+ */
+
+#include "benchmark.h"
+#include "MIPS_Interpreter.h"  // To access parseAssem_r, encodings, etc.
+#include "global_data.h"       // For Translator_Ctx and the instruction macros.
+#include "MIPS_Ingest.h"       // For ingestHexWords and ingestBinWords.
+#include "MIPS_Decode.h"       // For decodeMany.
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ITERATIONS 2000000
+
+// number of words in the text the bulk parsing benchmarks go through repeatedly
+#define BENCH_WORDS 1024
+
+// keeps the results alive so the timed loops can't be optimized away
+static volatile uint32_t bench_sink;
+
+/*
+    legacy_setBits_num
+
+    The original string based field setter: renders the number into a '0'/'1'
+    string the way the old num2bin() did and copies it bit by bit into the word.
+*/
+static void legacy_setBits_num(uint32_t* bin, uint32_t start, uint32_t num, uint32_t size)
+{
+    char str[40] = { '\0' };
+    int index = 0;
+
+    while (num > 0)
+    {
+        str[index++] = (num % 2) + 48;
+        num /= 2;
+    }
+    str[index] = '\0';
+
+    while (strlen(str) < size)
+    {
+        str[index++] = '0';
+        str[index] = '\0';
+    }
+
+    index--;
+    for (int i = 0; i < index; i++, index--)
+    {
+        char c = str[index];
+        str[index] = str[i];
+        str[i] = c;
+    }
+
+    for (size_t i = 0; i < strlen(str); i++)
+    {
+        if ((str[i] == '0') || (str[i] == '1'))
+        {
+            *bin |= (uint32_t)(str[i] - 48) << (start - i);
+        }
+    }
+}
+
+/*
+    legacy_pack
+
+    Packs an instruction the way the _assm functions used to: a setBits call per
+    field of the encoding, with the fixed bits set from the base.
+*/
+static uint32_t legacy_pack(const struct Encoding* enc, const struct Param* params)
+{
+    uint32_t bin = 0;
+
+    legacy_setBits_num(&bin, 31, enc->base >> 26, 6);
+    legacy_setBits_num(&bin, 5, enc->base & 0x3F, 6);
+
+    for (int i = 0; i < MAX_FIELDS; i++)
+    {
+        const struct Field* field = &enc->fields[i];
+
+        if (field->width != 0)
+        {
+            legacy_setBits_num(&bin, field->shift + field->width - 1, params[field->param].value, field->width);
+        }
+    }
+
+    return bin;
+}
+
+/*
+    legacy_getBits
+
+    The original field getter: rebuilds the field one bit at a time.
+*/
+static uint32_t legacy_getBits(uint32_t bin, uint32_t start, uint32_t size)
+{
+    uint32_t num = 0;
+    int end = start - size;
+
+    for (int i = start; i > end; i--)
+    {
+        num = (num * 2) + ((bin >> i) & 0x1);
+    }
+
+    return num;
+}
+
+/*
+    seconds_since
+
+    Returns the processor time in seconds since the given clock reading.
+*/
+static double seconds_since(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+/*
+    report
+
+    Prints one benchmark line with the time per operation for the baseline and
+    new implementation and the resulting speedup. 'baseline' names what the new
+    code is measured against.
+*/
+static void report(const char* name, const char* baseline, double baseline_time, double new_time)
+{
+    double baseline_ns = baseline_time * 1e9 / BENCH_ITERATIONS;
+    double new_ns = new_time * 1e9 / BENCH_ITERATIONS;
+
+    printf("  %-22s %-6s %8.2f ns/op   new %8.2f ns/op   speedup %6.1fx\n",
+           name, baseline, baseline_ns, new_ns, (new_time > 0) ? baseline_time / new_time : 0.0);
+}
+
+/*
+    bench_encode
+
+    Parses a line once and then times packing its fields with the legacy string
+    path and with packFields(), checking that both produce the same word.
+*/
+static void bench_encode(const char* line)
+{
+    Translator_Ctx bench_ctx;
+    Translator_Ctx* ctx = &bench_ctx;
+
+    initInstructs_r(ctx);
+    parseAssem_r(ctx, line, strlen(line));
+    if (STATE != NO_ERROR)
+    {
+        printf("  %-22s could not be parsed\n", line);
+        return;
+    }
+
+    const struct Encoding* enc = &encodings[OP_ID];
+    struct Param params[4];
+    memcpy(params, PARAMS, sizeof(params));
+
+    if (legacy_pack(enc, params) != packFields(enc, params))
+    {
+        printf("  %-22s MISMATCH between legacy and new encodings\n", line);
+        return;
+    }
+
+    clock_t start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        params[0].value = i & 0x1F;
+        bench_sink = legacy_pack(enc, params);
+    }
+    double legacy_time = seconds_since(start);
+
+    start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        params[0].value = i & 0x1F;
+        bench_sink = packFields(enc, params);
+    }
+    double new_time = seconds_since(start);
+
+    report(line, "legacy", legacy_time, new_time);
+}
+
+/*
+    bench_fields
+
+    Times pulling the rs, rt and immediate fields out of I-type words with the
+    bit at a time getter against the field_ accessors, checking both agree.
+*/
+static void bench_fields(void)
+{
+    static uint32_t words[BENCH_WORDS];
+
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        words[i] = i * 0x9E3779B9u;
+
+        uint32_t word = words[i];
+        if ((legacy_getBits(word, 25, 5) != field_rs(word)) || (legacy_getBits(word, 20, 5) != field_rt(word)) ||
+            (legacy_getBits(word, 15, 16) != field_imm16(word)))
+        {
+            printf("  %-22s MISMATCH between legacy and new fields\n", "rs, rt, imm16");
+            return;
+        }
+    }
+
+    clock_t start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        uint32_t word = words[i % BENCH_WORDS];
+        bench_sink = legacy_getBits(word, 25, 5) + legacy_getBits(word, 20, 5) + legacy_getBits(word, 15, 16);
+    }
+    double legacy_time = seconds_since(start);
+
+    start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        uint32_t word = words[i % BENCH_WORDS];
+        bench_sink = field_rs(word) + field_rt(word) + field_imm16(word);
+    }
+    double new_time = seconds_since(start);
+
+    report("rs, rt, imm16", "legacy", legacy_time, new_time);
+}
+
+/*
+    bench_hex_ingest
+
+    Times converting a hex dump one line at a time with parseHex_r() against
+    converting it in bulk with ingestHexWords(), checking both get the same words.
+*/
+static void bench_hex_ingest(void)
+{
+    static char text[BENCH_WORDS * 9];
+    static uint32_t words[BENCH_WORDS];
+
+    Translator_Ctx bench_ctx;
+    Translator_Ctx* ctx = &bench_ctx;
+
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        sprintf(text + (i * 9), "%08X\n", i * 0x9E3779B9u);
+    }
+
+    Ingest_Result result = ingestHexWords(text, sizeof(text), words, BENCH_WORDS);
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        parseHex_r(ctx, text + (i * 9), 8);
+        if ((result.count != BENCH_WORDS) || (words[i] != BIN32))
+        {
+            printf("  %-22s MISMATCH between legacy and new parsing\n", "hex words");
+            return;
+        }
+    }
+
+    clock_t start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        parseHex_r(ctx, text + ((i % BENCH_WORDS) * 9), 8);
+        bench_sink = BIN32;
+    }
+    double legacy_time = seconds_since(start);
+
+    start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i += BENCH_WORDS)
+    {
+        result = ingestHexWords(text, sizeof(text), words, BENCH_WORDS);
+        bench_sink = words[result.count - 1];
+    }
+    double new_time = seconds_since(start);
+
+    report("hex words", "legacy", legacy_time, new_time);
+}
+
+/*
+    bench_bin_ingest
+
+    Times converting printMachine style binary lines one at a time with
+    parseBin_r() against converting them in bulk with ingestBinWords(), checking
+    both get the same words.
+*/
+static void bench_bin_ingest(void)
+{
+    static char text[BENCH_WORDS * (BINARY32_SIZE + 1)];
+    static uint32_t words[BENCH_WORDS];
+
+    Translator_Ctx bench_ctx;
+    Translator_Ctx* ctx = &bench_ctx;
+
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        char* line = appendBinary32(text + (i * (BINARY32_SIZE + 1)), i * 0x9E3779B9u);
+        *line = '\n';
+    }
+
+    Ingest_Result result = ingestBinWords(text, sizeof(text), words, BENCH_WORDS);
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        parseBin_r(ctx, text + (i * (BINARY32_SIZE + 1)), BINARY32_SIZE);
+        if ((result.count != BENCH_WORDS) || (words[i] != BIN32))
+        {
+            printf("  %-22s MISMATCH between legacy and new parsing\n", "binary words");
+            return;
+        }
+    }
+
+    clock_t start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        parseBin_r(ctx, text + ((i % BENCH_WORDS) * (BINARY32_SIZE + 1)), BINARY32_SIZE);
+        bench_sink = BIN32;
+    }
+    double legacy_time = seconds_since(start);
+
+    start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i += BENCH_WORDS)
+    {
+        result = ingestBinWords(text, sizeof(text), words, BENCH_WORDS);
+        bench_sink = words[result.count - 1];
+    }
+    double new_time = seconds_since(start);
+
+    report("binary words", "legacy", legacy_time, new_time);
+}
+
+/*
+    bench_decode_many
+
+    Times decoding a mix of instruction words one at a time with decode_r()
+    against splitting them in bulk with decodeMany(), checking that every field
+    decodeMany() fills matches the field_ accessors and that both pick the same
+    instruction for every word.
+*/
+static void bench_decode_many(void)
+{
+    static uint32_t words[BENCH_WORDS];
+    static uint8_t id[BENCH_WORDS], opcode[BENCH_WORDS], rs[BENCH_WORDS], rt[BENCH_WORDS];
+    static uint8_t rd[BENCH_WORDS], shamt[BENCH_WORDS], funct[BENCH_WORDS];
+    static uint16_t imm[BENCH_WORDS];
+    Decoded_Fields fields = { id, opcode, rs, rt, rd, shamt, funct, imm };
+
+    Translator_Ctx bench_ctx;
+    Translator_Ctx* ctx = &bench_ctx;
+
+    // every instruction with scrambled operand bits
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        const struct Bit_Pattern* pattern = &patterns[i % OP_COUNT];
+        words[i] = ((i * 0x9E3779B9u) & ~pattern->mask) | pattern->match;
+    }
+
+    decodeMany(words, BENCH_WORDS, &fields);
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        uint32_t word = words[i];
+
+        initInstructs_r(ctx);
+        BIN32 = word;
+        decode_r(ctx);
+        if ((STATE != COMPLETE_DECODE) || (id[i] != OP_ID) ||
+            (opcode[i] != field_opcode(word)) || (rs[i] != field_rs(word)) || (rt[i] != field_rt(word)) ||
+            (rd[i] != field_rd(word)) || (shamt[i] != field_shamt(word)) || (funct[i] != field_funct(word)) ||
+            (imm[i] != field_imm16(word)))
+        {
+            printf("  %-22s MISMATCH between scalar and bulk decoding of 0x%08X\n", "decode words", word);
+            return;
+        }
+    }
+
+    clock_t start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        BIN32 = words[i % BENCH_WORDS];
+        decode_r(ctx);
+        bench_sink = OP_ID;
+    }
+    double scalar_time = seconds_since(start);
+
+    start = clock();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i += BENCH_WORDS)
+    {
+        decodeMany(words, BENCH_WORDS, &fields);
+        bench_sink = id[BENCH_WORDS - 1];
+    }
+    double new_time = seconds_since(start);
+
+    report("decode words", "scalar", scalar_time, new_time);
+}
+
+/*
+    run_benchmarks
+
+    Runs each benchmark and prints the results.
+*/
+void run_benchmarks(void)
+{
+    printf("Running benchmarks with %d iterations each...\n\n", BENCH_ITERATIONS);
+
+    puts("Field packing:");
+    bench_encode("ADD $t0, $t1, $t2");
+    bench_encode("ADDI $t0, $t1, #0x1234");
+    bench_encode("LW $t0, #0x4($s1)");
+    bench_encode("SW $t0, #0x8($s1)");
+
+    puts("\nField extraction:");
+    bench_fields();
+
+    puts("\nBulk parsing:");
+    bench_hex_ingest();
+    bench_bin_ingest();
+
+    puts("\nBulk decoding:");
+    bench_decode_many();
+}
@@ -0,0 +1,12 @@
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+/*
+    run_benchmarks
+
+    Times the translator's hot paths against the implementations they replaced
+    and prints the time per operation and the speedup for each one.
+*/
+void run_benchmarks(void);
+
+#endif
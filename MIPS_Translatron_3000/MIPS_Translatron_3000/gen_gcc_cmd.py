@@ -26,7 +26,7 @@ def main(args):
     for file in c_files:
         gcc_cmd += file + ' '
 
-    gcc_cmd += '-o MIPS_translatron'
+    gcc_cmd += '-pthread -o MIPS_translatron'
 
     # auto run compiler if told to
     if args.run:
@@ -4,21 +4,25 @@
 #define _GLOBAL_DATA_H_
 
 #include <stdint.h>
+#include "MIPS_Isa.h"
 
 /*----------------------------\
 		   Defines
 \----------------------------*/
 #define OP_SIZE 10
-#define OP_CODE assm_instruct.op
-//#define S_FLAG assm_instruct.s_flag
+#define OP_CODE ctx->assm.op
+#define OP_ID ctx->assm.id
+//#define S_FLAG ctx->assm.s_flag
 #define COND_SIZE 2
-#define COND assm_instruct.cond
-#define PARAM1 assm_instruct.param1
-#define PARAM2 assm_instruct.param2
-#define PARAM3 assm_instruct.param3
-#define PARAM4 assm_instruct.param4
-//#define SHIFT assm_instruct.shift
-#define BIN32 instruct
+#define COND ctx->assm.cond
+#define PARAM1 ctx->assm.param1
+#define PARAM2 ctx->assm.param2
+#define PARAM3 ctx->assm.param3
+#define PARAM4 ctx->assm.param4
+#define PARAMS ctx->assm.params
+//#define SHIFT ctx->assm.shift
+#define BIN32 ctx->bin
+#define STATE ctx->status
 
 /*----------------------------\
 		   Enums
@@ -42,9 +46,20 @@ enum code {
 	MISSING_COMMA,
 	INVALID_SHIFT,
 	MISSING_SHIFT,
+	UNDEFINED_LABEL,
+	DUPLICATE_LABEL,
 	UNDEF_ERROR
 };
 
+// ids for each supported instruction, used to index the encoder table, generated from ISA_TABLE
+typedef enum Op_Id {
+#define OP_ENUM(name, ...) OP_##name,
+	ISA_TABLE(OP_ENUM)
+#undef OP_ENUM
+	OP_COUNT,
+	OP_NONE = OP_COUNT
+} Op_Id;
+
 // type of possible parameters
 typedef enum Param_Type {
 	EMPTY,
@@ -70,25 +85,64 @@ struct Param {
 	uint32_t value;
 };
 
+// struct describing where a parameter is packed into the binary instruction
+struct Field {
+	uint8_t shift;	// bit position of the least significant bit of the field
+	uint8_t width;	// number of bits in the field, 0 for an unused field
+	uint8_t param;	// index of the parameter that supplies the value, 0 for PARAM1
+	uint8_t type;	// Param_Type the parameter must be, EMPTY for an unused field
+	uint8_t error;	// state set when the parameter isn't that type
+	uint32_t max;	// largest value the parameter can have
+};
+
+// maximum number of parameter fields in one instruction
+#define MAX_FIELDS 3
+
+// struct for the binary layout of an instruction
+struct Encoding {
+	uint32_t base;	// fixed bits such as the opcode and function code
+	struct Field fields[MAX_FIELDS];
+};
+
+// struct for a compiled bit pattern, a word matches when (word & mask) == match
+struct Bit_Pattern {
+	uint32_t mask;	// 1 for every bit the pattern checks
+	uint32_t match;	// the value of the checked bits
+};
+
 // struct for the text instruction
 typedef struct {
 	char op[OP_SIZE + 1];
+	Op_Id id;
 	//int s_flag;
 	char cond[COND_SIZE + 1];
-	struct Param param1;
-	struct Param param2;
-	struct Param param3;
-	struct Param param4;
+	// the parameters can be used by name or by index
+	union {
+		struct {
+			struct Param param1;
+			struct Param param2;
+			struct Param param3;
+			struct Param param4;
+		};
+		struct Param params[4];
+	};
 	//Shift_Type shift;
 } Assm_Instruct;
 
 
+// struct holding everything one translation works on, so several can run at once
+typedef struct {
+	Assm_Instruct assm;	// the text instruction
+	uint32_t bin;		// the binary instruction
+	uint16_t status;	// code from the last operation
+} Translator_Ctx;
+
+
 /*----------------------------\
 		 Global Variables
 \----------------------------*/
 
-extern Assm_Instruct assm_instruct;
-extern uint32_t instruct;
-extern uint16_t state;
+// context used by the functions that don't take one
+extern Translator_Ctx default_ctx;
 
 #endif
\ No newline at end of file
@@ -8,7 +8,13 @@
 
 #include "test_bench.h"
 #include "MIPS_Interpreter.h"  // To access initAll, parseAssem, encode, decode, etc.
-#include "global_data.h"       // For the global assm_instruct and state.
+#include "global_data.h"       // For default_ctx, the default translation context.
+#include "MIPS_Format.h"       // For reg_names and appendImm, shared with printParam.
+#include "MIPS_Batch.h"        // For assembleFile, which resolves labels in two passes.
+#include "MIPS_Symbols.h"      // For the symbol table the label cases look labels up in.
+#include "MIPS_Ingest.h"       // For the bulk parsers, run on each of their paths.
+#include "MIPS_Cpu.h"          // For the vector instruction sets the processor has.
+#include "MIPS_Decode.h"       // For decodeMany, checked against decode one word at a time.
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -16,175 +22,90 @@
 
 #define ASM_BUFFER_SIZE 200
 
+// most words a bulk parsing case can give, and the most text it can have
+#define INGEST_TEST_WORDS 32
+#define INGEST_TEST_SIZE 2048
+
+// most words a bulk decoding case can give, more than one AVX2 block and a tail
+#define DECODE_TEST_WORDS 1024
+
+// words the bulk parsing cases are written from, spread over every nibble and both signs
+static const uint32_t ingest_values[16] = {
+    0x00000000, 0xFFFFFFFF, 0x012A4020, 0xDEADBEEF, 0x8E287FFF, 0x1109FFFC, 0x80000001, 0x7FFFFFFE,
+    0x0F0F0F0F, 0xF0F0F0F0, 0x3128FFFF, 0x00000001, 0x12345678, 0xA5A5A5A5, 0x5A5A5A5A, 0xCAFEBABE
+};
+
 /*
-    reg_to_str
+    append_param
 
-    Converts a register number into its corresponding string representation.
-    Uses the same register mapping as printParam function.
-    The result is written into 'temp' (of size temp_size) if needed.
-    Returns a pointer to a string representing the register.
+    Writes one parameter at 'pos' the way printParam does and returns the position
+    after it. Registers use the reg_names and reg_name_lens tables that printParam
+    formats with, so the two can't disagree. Registers past 31 are written as
+    "<unknown>".
 */
-static const char* reg_to_str(uint32_t reg, char* temp, size_t temp_size)
+static char* append_param(char* pos, const struct Param* param)
 {
-    if (reg == 0) 
-    {
-        return "$zero";
-    } 
-    else if (reg == 2 || reg == 3) 
-    {
-        snprintf(temp, temp_size, "$v%d", reg - 2);
-        return temp;
-    } 
-    else if (reg >= 4 && reg <= 7) 
+    if (param->type == REGISTER)
     {
-        snprintf(temp, temp_size, "$a%d", reg - 4);
-        return temp;
-    } 
-    else if (reg >= 8 && reg <= 15) 
-    {
-        snprintf(temp, temp_size, "$t%d", reg - 8);
-        return temp;
-    } 
-    else if (reg >= 16 && reg <= 23) 
-    {
-        snprintf(temp, temp_size, "$s%d", reg - 16);
-        return temp;
+        if (param->value >= 32)
+        {
+            return appendStr(pos, "<unknown>", 9);
+        }
+        return appendStr(pos, reg_names[param->value], reg_name_lens[param->value]);
     }
-    else if (reg == 24 || reg == 25) 
-    {
-        snprintf(temp, temp_size, "$t%d", reg - 16);
-        return temp;
-    } 
-    else if (reg == 28) 
+    else if (param->type == IMMEDIATE)
     {
-        return "$gp";
-    } 
-    else if (reg == 29) 
-    {
-        return "$sp";
-    } 
-    else if (reg == 30) 
-    {
-        return "$fp";
+        return appendImm(pos, param->value);
     }
-    else if (reg == 31) 
+    else
     {
-        return "$ra";
-    } 
-    else 
-    {
-        return "<unknown>";
+        return appendStr(pos, "<>", 2);
     }
 }
 
 /*
     getAssemblyString
 
-    Fills the provided buffer with the assembly instruction generated from the global 
-    'assm_instruct' structure. This function mimics the behavior of printAssm(), but 
-    writes into a string for automated comparison.
+    Fills the provided buffer with the assembly instruction generated from the 
+    'default_ctx.assm' structure. This function mimics the behavior of printAssm(), but 
+    writes into a string for automated comparison. LW and SW list the base register
+    after a comma instead of in brackets, which is how the test cases are written.
+
+    The string is built with a cursor, so each piece is written once instead of the
+    whole buffer being rescanned for every append. The longest possible instruction
+    is under 64 characters, shorter buffers get an empty string.
 */
 static void getAssemblyString(char *buf, size_t buf_size) 
 {
-    buf[0] = '\0';
-
-    // Append opcode.
-    strncat(buf, assm_instruct.op, buf_size - strlen(buf) - 1);
-    strncat(buf, " ", buf_size - strlen(buf) - 1);
+    const Assm_Instruct* assm = &default_ctx.assm;
 
-    char temp[50];
-
-    // For param1.
-    if (assm_instruct.param1.type != EMPTY) 
+    buf[0] = '\0';
+    if (buf_size < 64)
     {
-        if (assm_instruct.param1.type == REGISTER) 
-        {
-            strncat(buf, reg_to_str(assm_instruct.param1.value, temp, sizeof(temp)), 
-                    buf_size - strlen(buf) - 1);
-        }
-        else if (assm_instruct.param1.type == IMMEDIATE)
-        {
-            snprintf(temp, sizeof(temp), "#0x%X", assm_instruct.param1.value);
-            strncat(buf, temp, buf_size - strlen(buf) - 1);
-        }
-        else 
-        {
-            strncat(buf, "<>", buf_size - strlen(buf) - 1);
-        }
+        return;
     }
 
-    // For param2.
-    if (assm_instruct.param2.type != EMPTY) 
-    {
-        strncat(buf, ", ", buf_size - strlen(buf) - 1);
-        if (assm_instruct.param2.type == REGISTER) 
-        {
-            strncat(buf, reg_to_str(assm_instruct.param2.value, temp, sizeof(temp)), 
-                    buf_size - strlen(buf) - 1);
-        }
-        else if (assm_instruct.param2.type == IMMEDIATE) 
-        {
-            snprintf(temp, sizeof(temp), "#0x%X", assm_instruct.param2.value);
-            strncat(buf, temp, buf_size - strlen(buf) - 1);
-        }
-        else 
-        {
-            strncat(buf, "<>", buf_size - strlen(buf) - 1);
-        }
-    }
+    // Append opcode.
+    char* pos = appendStr(buf, assm->op, strlen(assm->op));
+    *pos++ = ' ';
 
-   // For param3.
-   if (assm_instruct.param3.type != EMPTY) 
-   {
-    /* For LW and SW, print a comma followed by the register */
-    if (assm_instruct.param3.type == REGISTER &&
-        (strcmp(assm_instruct.op, "LW") == 0 || strcmp(assm_instruct.op, "SW") == 0)) 
+    // Param1 has no separator, the rest are each preceded by a comma.
+    if (assm->param1.type != EMPTY)
     {
-        strncat(buf, ", ", buf_size - strlen(buf) - 1);
-        strncat(buf, reg_to_str(assm_instruct.param3.value, temp, sizeof(temp)),
-                buf_size - strlen(buf) - 1);
+        pos = append_param(pos, &assm->param1);
     }
-    else 
-    {
-        strncat(buf, ", ", buf_size - strlen(buf) - 1);
-        if (assm_instruct.param3.type == REGISTER) 
-        {
-            strncat(buf, reg_to_str(assm_instruct.param3.value, temp, sizeof(temp)),
-                    buf_size - strlen(buf) - 1);
-        }
-        else if (assm_instruct.param3.type == IMMEDIATE) 
-        {
-            snprintf(temp, sizeof(temp), "#0x%X", assm_instruct.param3.value);
-            strncat(buf, temp, buf_size - strlen(buf) - 1);
-        }
-        else 
-        {
-            strncat(buf, "<>", buf_size - strlen(buf) - 1);
-        }
-    }
-}
 
-    // For param4.
-    if (assm_instruct.param4.type != EMPTY) 
+    for (int i = 1; i < 4; i++)
     {
-        strncat(buf, ", ", buf_size - strlen(buf) - 1);
-        if (assm_instruct.param4.type == REGISTER) 
+        if (assm->params[i].type != EMPTY)
         {
-            strncat(buf, reg_to_str(assm_instruct.param4.value, temp, sizeof(temp)), 
-                    buf_size - strlen(buf) - 1);
-        }
-        else if (assm_instruct.param4.type == IMMEDIATE) 
-        {
-            snprintf(temp, sizeof(temp), "#0x%X", assm_instruct.param4.value);
-            strncat(buf, temp, buf_size - strlen(buf) - 1);
-        }
-        else 
-        {
-            strncat(buf, "<>", buf_size - strlen(buf) - 1);
+            pos = appendStr(pos, ", ", 2);
+            pos = append_param(pos, &assm->params[i]);
         }
     }
 
-    strncat(buf, "\n", buf_size - strlen(buf) - 1);
+    *pos++ = '\n';
+    *pos = '\0';
 }
 
 /*
@@ -225,26 +146,26 @@ static int run_test_case(const char *test_input)
     initAll(); // Resets global state.
 
     parseAssem(input_copy);
-    if (state != NO_ERROR) 
+    if (default_ctx.status != NO_ERROR) 
     {
         printf("Test FAILED for input: \"%s\"\n", test_input);
-        printf("  Error during parsing: state=%d\n", state);
+        printf("  Error during parsing: state=%d\n", default_ctx.status);
         return 0;
     }
 
     encode();
-    if (state != NO_ERROR && state != COMPLETE_ENCODE) 
+    if (default_ctx.status != NO_ERROR && default_ctx.status != COMPLETE_ENCODE) 
     {
         printf("Test FAILED for input: \"%s\"\n", test_input);
-        printf("  Error during encoding: state=%d\n", state);
+        printf("  Error during encoding: state=%d\n", default_ctx.status);
         return 0;
     }
 
     decode();
-    if (state != NO_ERROR && state != COMPLETE_DECODE) 
+    if (default_ctx.status != NO_ERROR && default_ctx.status != COMPLETE_DECODE) 
     {
         printf("Test FAILED for input: \"%s\"\n", test_input);
-        printf("  Error during decoding: state=%d\n", state);
+        printf("  Error during decoding: state=%d\n", default_ctx.status);
         return 0;
     }
 
@@ -270,6 +191,767 @@ static int run_test_case(const char *test_input)
     }
 }
 
+/*
+    Encode_Case
+
+    A line for assembleLine and the state it should give back. The word is only
+    compared when the state is COMPLETE_ENCODE.
+*/
+typedef struct
+{
+    const char *line;
+    uint16_t state;
+    uint32_t word;
+} Encode_Case;
+
+/*
+    run_encode_case
+
+    Assembles one line straight to a word with assembleLine and compares the
+    state, and the word if it was encoded, to what the case expects. Labels are
+    looked up in 'labels', which can be NULL.
+
+    Returns 1 if the test passes, 0 otherwise, and prints details to stdout.
+*/
+static int run_encode_case(const Encode_Case *test, const Label_Scope *labels)
+{
+    uint32_t word = 0;
+    uint16_t state = assembleLine(test->line, strlen(test->line), labels, &word);
+
+    if ((state == test->state) && ((state != COMPLETE_ENCODE) || (word == test->word)))
+    {
+        printf("Test PASSED for input: \"%s\"\n", test->line);
+        return 1;
+    }
+
+    printf("Test FAILED for input: \"%s\"\n", test->line);
+    printf("  Expected: state=%d word=0x%08X\n", test->state, test->word);
+    printf("  Got:      state=%d word=0x%08X\n", state, word);
+    return 0;
+}
+
+/*
+    run_immediate_tests
+
+    Checks how immediates are read: negative numbers in the signed fields, 0x
+    and 0b literals, the largest value of a field and one past it, numbers that
+    don't fit in 32 bits and a '-' without a number. The round trip cases can't
+    reach these, since an error never decodes and a negative number decodes as
+    its field bits.
+
+    Adds the number of cases to 'num_tests' and returns how many passed.
+*/
+static int run_immediate_tests(int *num_tests)
+{
+    static const Encode_Case cases[] = {
+        // negative numbers are two's complement, down to the lowest value the field holds
+        { "ADDI $t0, $t1, #-1", COMPLETE_ENCODE, 0x2128FFFF },
+        { "ADDI $t0, $t1, #-32768", COMPLETE_ENCODE, 0x21288000 },
+        { "ADDI $t0, $t1, #-32769", INVALID_IMMED, 0 },
+        { "SLTI $t0, $t1, #-2", COMPLETE_ENCODE, 0x2928FFFE },
+        { "LW $t0, #-4, $s1", COMPLETE_ENCODE, 0x8E28FFFC },
+        { "SW $t0, #-4, $s1", COMPLETE_ENCODE, 0xAE28FFFC },
+        { "BEQ $t0, $t1, #-1", COMPLETE_ENCODE, 0x1109FFFF },
+        { "ANDI $t0, $t1, #-1", INVALID_IMMED, 0 },
+
+        // hex and binary literals, either case of prefix
+        { "ADDI $t0, $t1, #0X1f", COMPLETE_ENCODE, 0x2128001F },
+        { "ADDI $t0, $t1, #0b1010", COMPLETE_ENCODE, 0x2128000A },
+        { "ORI $t0, $t1, #0B11", COMPLETE_ENCODE, 0x35280003 },
+        { "ADDI $t0, $t1, #-0x10", COMPLETE_ENCODE, 0x2128FFF0 },
+        { "ADDI $t0, $t1, #0b2", INVALID_PARAM, 0 },
+        { "ADDI $t0, $t1, #0x", COMPLETE_ENCODE, 0x21280000 },
+
+        // the largest value of each kind of field, and one past it
+        { "ADDI $t0, $t1, #0xFFFF", COMPLETE_ENCODE, 0x2128FFFF },
+        { "ADDI $t0, $t1, #0x10000", INVALID_IMMED, 0 },
+        { "LW $t0, #0x7FFF, $s1", COMPLETE_ENCODE, 0x8E287FFF },
+        { "LW $t0, #0x8000, $s1", INVALID_IMMED, 0 },
+        { "ANDI $t0, $t1, #0xFFFF", COMPLETE_ENCODE, 0x3128FFFF },
+        { "ANDI $t0, $t1, #0x10000", INVALID_IMMED, 0 },
+
+        // 2^32 doesn't fit in any base
+        { "ADDI $t0, $t1, #4294967296", INVALID_IMMED, 0 },
+        { "ADDI $t0, $t1, #0x100000000", INVALID_IMMED, 0 },
+        { "ADDI $t0, $t1, #0b100000000000000000000000000000000", INVALID_IMMED, 0 },
+        { "ADDI $t0, $t1, #-2147483649", INVALID_IMMED, 0 },
+
+        // a '-' has to be followed by a number
+        { "ADDI $t0, $t1, #-", INVALID_IMMED, 0 },
+        { "ADDI $t0, $t1, #--1", INVALID_IMMED, 0 }
+    };
+    const int count = sizeof(cases) / sizeof(cases[0]);
+    int passed = 0;
+
+    printf("\nRunning %d immediate test case(s)...\n\n", count);
+    for (int i = 0; i < count; i++)
+    {
+        passed += run_encode_case(&cases[i], NULL);
+    }
+
+    *num_tests += count;
+    return passed;
+}
+
+/*
+    run_reg_name_case
+
+    Converts one register name, without the $, with reg2num and compares the
+    number to 'expected', which is (uint32_t)-1 for a name that isn't a register.
+
+    Returns 1 if the test passes, 0 otherwise, and prints details to stdout.
+*/
+static int run_reg_name_case(const char *name, uint32_t expected)
+{
+    char copy[16];
+    snprintf(copy, sizeof(copy), "%s", name);
+
+    uint32_t num = reg2num(copy);
+    if (num == expected)
+    {
+        return 1;
+    }
+
+    printf("Test FAILED for input: \"$%s\"\n", name);
+    printf("  Expected: %d\n", (int)expected);
+    printf("  Got:      %d\n", (int)num);
+    return 0;
+}
+
+/*
+    run_register_tests
+
+    Checks register names: every ABI name in reg_names reads back as its
+    number, and so does every number from 0 to 31, with or without a leading
+    zero. $s8 is another name for $fp. Names that are close to a register but
+    aren't one are rejected. Then a few lines with these names are assembled.
+
+    Adds the number of cases to 'num_tests' and returns how many passed.
+*/
+static int run_register_tests(int *num_tests)
+{
+    static const struct
+    {
+        const char *name;
+        uint32_t num;
+    } names[] = {
+        { "s8", 30 }, { "00", 0 }, { "09", 9 },
+        { "32", (uint32_t)-1 }, { "40", (uint32_t)-1 }, { "100", (uint32_t)-1 },
+        { "t10", (uint32_t)-1 }, { "k2", (uint32_t)-1 }, { "v2", (uint32_t)-1 }, { "a4", (uint32_t)-1 },
+        { "s9", (uint32_t)-1 }, { "T0", (uint32_t)-1 }, { "zer", (uint32_t)-1 }, { "zeroo", (uint32_t)-1 },
+        { "ab", (uint32_t)-1 }, { "", (uint32_t)-1 }
+    };
+    static const Encode_Case cases[] = {
+        { "ADD $at, $k0, $31", COMPLETE_ENCODE, 0x035F0820 },
+        { "ADD $s8, $08, $0", COMPLETE_ENCODE, 0x0100F020 },
+        { "ADD $t0, $t1, $32", INVALID_REG, 0 },
+        { "ADD $t0, $t1, $T0", INVALID_REG, 0 }
+    };
+    const int name_count = sizeof(names) / sizeof(names[0]);
+    const int case_count = sizeof(cases) / sizeof(cases[0]);
+    int passed = 0;
+    int ok;
+
+    printf("\nRunning %d register test case(s)...\n\n", name_count + case_count + 2);
+
+    ok = 1;
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        ok &= run_reg_name_case(reg_names[i] + 1, i);
+    }
+    if (ok)
+    {
+        printf("Test PASSED for input: \"every ABI register name\"\n");
+    }
+    passed += ok;
+
+    ok = 1;
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        char name[4];
+        snprintf(name, sizeof(name), "%u", i);
+        ok &= run_reg_name_case(name, i);
+    }
+    if (ok)
+    {
+        printf("Test PASSED for input: \"$0 to $31\"\n");
+    }
+    passed += ok;
+
+    for (int i = 0; i < name_count; i++)
+    {
+        if (run_reg_name_case(names[i].name, names[i].num))
+        {
+            printf("Test PASSED for input: \"$%s\"\n", names[i].name);
+            passed++;
+        }
+    }
+
+    for (int i = 0; i < case_count; i++)
+    {
+        passed += run_encode_case(&cases[i], NULL);
+    }
+
+    *num_tests += name_count + case_count + 2;
+    return passed;
+}
+
+/*
+    run_assemble_case
+
+    Assembles a whole source file with assembleFile, the way batch mode does,
+    and compares the number of lines with errors, and the hex output unless
+    'expected' is NULL. The errors themselves are printed to stderr.
+
+    Returns 1 if the test passes, 0 otherwise, and prints details to stdout.
+*/
+static int run_assemble_case(const char *name, const char *source, const char *expected, uint32_t expected_errors)
+{
+    FILE *in = tmpfile();
+    FILE *out = tmpfile();
+    char *result = NULL;
+    uint32_t errors = 0;
+    int ok = 0;
+
+    if ((in != NULL) && (out != NULL))
+    {
+        fputs(source, in);
+        rewind(in);
+
+        // more than one thread, so the labels are merged and looked up across threads
+        errors = assembleFile(in, out, name, 2);
+
+        long len = ftell(out);
+        result = malloc((len > 0) ? (size_t)len + 1 : 1);
+        if (result != NULL)
+        {
+            rewind(out);
+            size_t read = (len > 0) ? fread(result, 1, (size_t)len, out) : 0;
+            result[read] = '\0';
+            ok = (errors == expected_errors) && ((expected == NULL) || (strcmp(result, expected) == 0));
+        }
+    }
+
+    if (ok)
+    {
+        printf("Test PASSED for file: \"%s\"\n", name);
+    }
+    else
+    {
+        printf("Test FAILED for file: \"%s\"\n", name);
+        printf("  Expected: %u error(s)%s%s\n", expected_errors, (expected == NULL) ? "" : ", output ", (expected == NULL) ? "" : expected);
+        printf("  Got:      %u error(s), output %s\n", errors, (result == NULL) ? "<none>" : result);
+    }
+
+    free(result);
+    if (in != NULL) fclose(in);
+    if (out != NULL) fclose(out);
+    return ok;
+}
+
+/*
+    run_label_tests
+
+    Checks branches to labels. Single lines are assembled against a symbol
+    table built here, for the error states and the ends of the 16 bit offset.
+    Whole files go through assembleFile for:
+      - forward and backward branches,
+      - lines with only a label,
+      - labels defined twice,
+      - undefined labels,
+      - a branch too far for its offset.
+
+    Adds the number of cases to 'num_tests' and returns how many passed.
+*/
+static int run_label_tests(int *num_tests)
+{
+    // the line being assembled is at 0x40000, offsets count words from 0x40004
+    static const struct
+    {
+        const char *name;
+        uint32_t address;
+    } labels[] = {
+        { "fwd", 0x40010 },
+        { "back", 0x3FFF0 },
+        { "self", 0x40000 },
+        { "top", 0x40004 + (4 * 32767) },
+        { "past_top", 0x40004 + (4 * 32768) },
+        { "bottom", 0x40004 - (4 * 32768) },
+        { "past_bottom", 0x40004 - (4 * 32769) },
+        { "fwd", 0x40020 }
+    };
+    static const Encode_Case cases[] = {
+        { "BEQ $t0, $t1, fwd", COMPLETE_ENCODE, 0x11090003 },
+        { "BNE $t0, $t1, back", COMPLETE_ENCODE, 0x1509FFFB },
+        { "BEQ $t0, $t1, self", COMPLETE_ENCODE, 0x1109FFFF },
+        { "BEQ $t0, $t1, top", COMPLETE_ENCODE, 0x11097FFF },
+        { "BEQ $t0, $t1, past_top", INVALID_IMMED, 0 },
+        { "BNE $t0, $t1, bottom", COMPLETE_ENCODE, 0x15098000 },
+        { "BNE $t0, $t1, past_bottom", INVALID_IMMED, 0 },
+        { "BEQ $t0, $t1, nowhere", UNDEFINED_LABEL, 0 },
+        { "BEQ $t0, $t1, #3", COMPLETE_ENCODE, 0x11090003 },
+        { "ADDI $t0, $t1, fwd", INVALID_PARAM, 0 }
+    };
+    const int label_count = sizeof(labels) / sizeof(labels[0]);
+    const int count = sizeof(cases) / sizeof(cases[0]);
+    const int total = count + 7; // the lines, the duplicate check and six files
+    Symbol_List list = { 0 };
+    Symbol_Table table;
+    int passed = 0;
+
+    printf("\nRunning %d label test case(s)...\n\n", total);
+
+    // each label is defined on its own line, so the second "fwd" is the duplicate
+    int duplicates = 0;
+    int built = (initSymbols(&table, label_count) == 0);
+    for (int i = 0; built && (i < label_count); i++)
+    {
+        built = (listSymbol(&list, labels[i].name, (uint32_t)strlen(labels[i].name), labels[i].address, (uint32_t)i + 1) == 0);
+    }
+    for (int i = 0; built && (i < label_count); i++)
+    {
+        duplicates += (mergeSymbol(&table, &list.symbols[i]) == SYMBOL_DUPLICATE);
+    }
+
+    if (built && (duplicates == 1) && (findSymbol(&table, "fwd", 3) == &list.symbols[0]))
+    {
+        printf("Test PASSED for input: \"duplicate fwd\"\n");
+        passed++;
+
+        Label_Scope scope = { &table, 0x40000 };
+        for (int i = 0; i < count; i++)
+        {
+            passed += run_encode_case(&cases[i], &scope);
+        }
+    }
+    else
+    {
+        printf("Test FAILED for input: \"duplicate fwd\"\n");
+        printf("  Expected: the first fwd kept and 1 duplicate\n");
+        printf("  Got:      %d duplicate(s)\n", duplicates);
+    }
+
+    freeSymbols(&table);
+    freeSymbolList(&list);
+
+    // label-only lines take no word, so "done" is the address of the SUB
+    passed += run_assemble_case("branches.s",
+        "start:\n"
+        "    ADD $t0, $t1, $t2\n"
+        "loop: BEQ $t0, $t1, done\n"
+        "    BNE $t0, $t1, loop\n"
+        "    BEQ $t0, $t1, start\n"
+        "done:\n"
+        "    SUB $t0, $t1, $t2\n",
+        "012A4020\n11090002\n1509FFFE\n1109FFFC\n012A4022\n", 0);
+
+    // the first definition wins, the second is an error but its line still assembles
+    passed += run_assemble_case("duplicate.s",
+        "a: ADD $t0, $t1, $t2\n"
+        "a: SUB $t0, $t1, $t2\n"
+        "BEQ $t0, $t1, a\n",
+        "012A4020\n012A4022\n1109FFFD\n", 1);
+
+    passed += run_assemble_case("undefined.s",
+        "ADD $t0, $t1, $t2\n"
+        "BNE $t0, $t1, missing\n",
+        "012A4020\n", 1);
+
+    passed += run_assemble_case("label_only.s", "only:\n", "", 0);
+
+    // 32768 words between the branch and the label is one past the largest forward offset
+    const char *far_line = "ADD $t0, $t1, $t2\n";
+    size_t far_len = strlen(far_line);
+    char *far = malloc(64 + (32769 * far_len));
+    char *edge = malloc(64 + (32768 * far_len));
+    if ((far != NULL) && (edge != NULL))
+    {
+        char *pos = far + sprintf(far, "BEQ $t0, $t1, far\n");
+        for (int i = 0; i < 32768; i++, pos += far_len)
+        {
+            memcpy(pos, far_line, far_len);
+        }
+        strcpy(pos, "far: ADD $t0, $t1, $t2\n");
+
+        // the same file with one word less reaches
+        pos = edge + sprintf(edge, "BEQ $t0, $t1, far\n");
+        for (int i = 0; i < 32767; i++, pos += far_len)
+        {
+            memcpy(pos, far_line, far_len);
+        }
+        strcpy(pos, "far: ADD $t0, $t1, $t2\n");
+
+        passed += run_assemble_case("far.s", far, NULL, 1);
+        passed += run_assemble_case("edge.s", edge, NULL, 0);
+    }
+    else
+    {
+        printf("Test FAILED for file: \"far.s\"\n  Could not allocate the source\n");
+    }
+    free(far);
+    free(edge);
+
+    *num_tests += total;
+    return passed;
+}
+
+// a bulk parser that can be limited to some of its paths, like ingestHexWordsUsing
+typedef Ingest_Result (*Ingest_Using)(const char *, size_t, uint32_t *, size_t, uint32_t);
+
+/*
+    run_ingest_case
+
+    Parses 'text' with the scalar path of a bulk parser, then with each vector
+    path the processor has. Every path has to give the 'count' words in
+    'expected' and stop at 'offset', on a malformed token if 'malformed' is
+    set. Checking every path against the same answer also checks them against
+    each other.
+
+    Returns 1 if the test passes, 0 otherwise, and prints details to stdout.
+*/
+static int run_ingest_case(const char *name, Ingest_Using ingest, const char *text, const uint32_t *expected, size_t count, int malformed, size_t offset)
+{
+    static const uint32_t paths[] = { 0, CPU_SSE41, CPU_SSE41 | CPU_AVX2 };
+    static const char *const path_names[] = { "scalar", "SSE4.1", "AVX2" };
+    uint32_t words[INGEST_TEST_WORDS];
+    char checked[32] = "";
+    int ok = 1;
+
+    for (int p = 0; p < 3; p++)
+    {
+        if ((cpuFeatures() & paths[p]) != paths[p])
+        {
+            continue;
+        }
+
+        // fills the words with a pattern, so a word that wasn't written can't match by chance
+        memset(words, 0xA5, sizeof(words));
+        Ingest_Result result = ingest(text, strlen(text), words, INGEST_TEST_WORDS, paths[p]);
+
+        if ((result.count != count) || (result.malformed != malformed) || (result.offset != offset) ||
+            (memcmp(words, expected, count * sizeof(uint32_t)) != 0))
+        {
+            if (ok)
+            {
+                printf("Test FAILED for input: \"%s\"\n", name);
+            }
+            printf("  Expected: %zu word(s), %s at %zu\n", count, malformed ? "malformed" : "ended", offset);
+            printf("  Got (%s): %zu word(s), %s at %zu\n", path_names[p], result.count, result.malformed ? "malformed" : "ended", result.offset);
+            for (size_t i = 0; (i < count) && (i < result.count); i++)
+            {
+                if (words[i] != expected[i])
+                {
+                    printf("  Word %zu: expected 0x%08X, got 0x%08X\n", i, expected[i], words[i]);
+                }
+            }
+            ok = 0;
+        }
+
+        strcat(checked, (checked[0] == '\0') ? "" : ", ");
+        strcat(checked, path_names[p]);
+    }
+
+    if (ok)
+    {
+        printf("Test PASSED for input: \"%s\" (%s)\n", name, checked);
+    }
+    return ok;
+}
+
+/*
+    hex_lines
+
+    Writes the first 'count' ingest_values at 'pos' with a printf format for
+    each, and returns the position after them.
+*/
+static char *hex_lines(char *pos, size_t count, const char *format)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        pos += sprintf(pos, format, ingest_values[i]);
+    }
+    return pos;
+}
+
+/*
+    run_hex_ingest_tests
+
+    Checks ingestHexWords on its scalar, SSE4.1 and AVX2 paths with:
+      - evenly spaced 8 digit words, which the vector paths take,
+      - CRLF line endings and a mix of line endings,
+      - short words and 0x prefixes, which only the scalar path takes,
+      - good words followed by trailing junk or a word that is too long.
+
+    Adds the number of cases to 'num_tests' and returns how many passed.
+*/
+static int run_hex_ingest_tests(int *num_tests)
+{
+    static const uint32_t short_words[] = { 0x1, 0x22, 0x333, 0x4444, 0x55555, 0x666666, 0x7777777 };
+    char text[INGEST_TEST_SIZE];
+    size_t len;
+    int passed = 0;
+    int count = 0;
+
+    printf("\nRunning hex ingest test case(s)...\n\n");
+
+    len = (size_t)(hex_lines(text, 16, "%08X\n") - text);
+    passed += run_ingest_case("16 hex lines", ingestHexWordsUsing, text, ingest_values, 16, 0, len);
+    count++;
+
+    len = (size_t)(hex_lines(text, 16, "%08x\r\n") - text);
+    passed += run_ingest_case("16 lowercase hex lines with CRLF", ingestHexWordsUsing, text, ingest_values, 16, 0, len);
+    count++;
+
+    // the stride changes every line, so the vector paths can't take more than one word at a time
+    char *pos = text;
+    for (size_t i = 0; i < 16; i++)
+    {
+        pos += sprintf(pos, (i % 2 == 0) ? "%08X\n" : "%08X\r\n", ingest_values[i]);
+    }
+    passed += run_ingest_case("16 hex lines with mixed line endings", ingestHexWordsUsing, text, ingest_values, 16, 0, (size_t)(pos - text));
+    count++;
+
+    len = (size_t)(hex_lines(text, 16, "%08X ") - text);
+    passed += run_ingest_case("16 hex words on one line", ingestHexWordsUsing, text, ingest_values, 16, 0, len);
+    count++;
+
+    len = (size_t)(hex_lines(text, 16, "0x%08X\n") - text);
+    passed += run_ingest_case("16 hex lines with 0x", ingestHexWordsUsing, text, ingest_values, 16, 0, len);
+    count++;
+
+    // the last word has no newline
+    len = (size_t)(hex_lines(text, 16, "%08X\n") - text) - 1;
+    text[len] = '\0';
+    passed += run_ingest_case("16 hex lines without a last newline", ingestHexWordsUsing, text, ingest_values, 16, 0, len);
+    count++;
+
+    strcpy(text, "1\n22\n333\n4444\n55555\n666666\n7777777\n");
+    passed += run_ingest_case("hex words of 1 to 7 digits", ingestHexWordsUsing, text, short_words, 7, 0, strlen(text));
+    count++;
+
+    // trailing junk stops every path at the start of the bad token
+    len = (size_t)(hex_lines(text, 12, "%08X\n") - text);
+    strcpy(text + len, "0000000G\n");
+    passed += run_ingest_case("hex lines then 0000000G", ingestHexWordsUsing, text, ingest_values, 12, 1, len);
+    count++;
+
+    strcpy(text + len, "123456780x\n");
+    passed += run_ingest_case("hex lines then 123456780x", ingestHexWordsUsing, text, ingest_values, 12, 1, len);
+    count++;
+
+    // ingest_values[12] is 0x12345678, so the word before the bad token is still parsed
+    strcpy(text + len, "12345678 0x\n");
+    passed += run_ingest_case("hex lines then 12345678 0x", ingestHexWordsUsing, text, ingest_values, 13, 1, len + 9);
+    count++;
+
+    strcpy(text + len, "123456789\n");
+    passed += run_ingest_case("hex lines then 9 digits", ingestHexWordsUsing, text, ingest_values, 12, 1, len);
+    count++;
+
+    *num_tests += count;
+    return passed;
+}
+
+/*
+    bin_lines
+
+    Writes 'count' values at 'pos' as 32 binary digits, solid or in groups of 4
+    like printMachine writes them, each followed by 'newline', and returns the
+    position after them.
+*/
+static char *bin_lines(char *pos, const uint32_t *values, size_t count, int grouped, const char *newline)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        for (int bit = 31; bit >= 0; bit--)
+        {
+            *pos++ = (char)('0' + ((values[i] >> bit) & 1));
+            if (grouped && (bit % 4 == 0) && (bit > 0))
+            {
+                *pos++ = ' ';
+            }
+        }
+        pos += sprintf(pos, "%s", newline);
+    }
+    return pos;
+}
+
+/*
+    run_bin_ingest_tests
+
+    Checks ingestBinWords on its scalar, SSE4.1 and AVX2 paths with:
+      - solid and grouped 32 digit lines, which the vector paths take,
+      - CRLF line endings and a mix of solid and grouped lines,
+      - words shorter than 32 digits and 0b prefixes, which only the scalar path takes,
+      - good lines followed by trailing junk or a word that is too long.
+
+    A bare "0101" is read as the word 0x00000005: a binary file gives each
+    word as its value, so leading zeros can be left off the same way parseBin
+    has always allowed.
+
+    Adds the number of cases to 'num_tests' and returns how many passed.
+*/
+static int run_bin_ingest_tests(int *num_tests)
+{
+    static const uint32_t short_words[] = { 0x5, 0x1, 0x3, 0x5, 0x56 };
+    char text[INGEST_TEST_SIZE];
+    size_t len;
+    int passed = 0;
+    int count = 0;
+
+    printf("\nRunning binary ingest test case(s)...\n\n");
+
+    len = (size_t)(bin_lines(text, ingest_values, 16, 0, "\n") - text);
+    passed += run_ingest_case("16 solid binary lines", ingestBinWordsUsing, text, ingest_values, 16, 0, len);
+    count++;
+
+    len = (size_t)(bin_lines(text, ingest_values, 16, 1, "\n") - text);
+    passed += run_ingest_case("16 grouped binary lines", ingestBinWordsUsing, text, ingest_values, 16, 0, len);
+    count++;
+
+    len = (size_t)(bin_lines(text, ingest_values, 16, 0, "\r\n") - text);
+    passed += run_ingest_case("16 solid binary lines with CRLF", ingestBinWordsUsing, text, ingest_values, 16, 0, len);
+    count++;
+
+    len = (size_t)(bin_lines(text, ingest_values, 16, 1, "\r\n") - text);
+    passed += run_ingest_case("16 grouped binary lines with CRLF", ingestBinWordsUsing, text, ingest_values, 16, 0, len);
+    count++;
+
+    // a solid and a grouped line take turns, each one written from its own value
+    char *pos = text;
+    for (size_t i = 0; i < 16; i++)
+    {
+        pos = bin_lines(pos, &ingest_values[i], 1, (int)(i % 2), "\n");
+    }
+    passed += run_ingest_case("16 solid and grouped binary lines", ingestBinWordsUsing, text, ingest_values, 16, 0, (size_t)(pos - text));
+    count++;
+
+    strcpy(text, "0101\n");
+    passed += run_ingest_case("bare 0101 is 0x00000005", ingestBinWordsUsing, text, short_words, 1, 0, strlen(text));
+    count++;
+
+    strcpy(text, "0101\r\n1\n0b11\n0000 0101\n0101 0110");
+    passed += run_ingest_case("binary words shorter than 32 digits", ingestBinWordsUsing, text, short_words, 5, 0, strlen(text));
+    count++;
+
+    // trailing junk and long words stop every path at the start of the line
+    len = (size_t)(bin_lines(text, ingest_values, 12, 0, "\n") - text);
+    strcpy(text + len, "0000000000000000000000000000000G\n");
+    passed += run_ingest_case("binary lines then a G", ingestBinWordsUsing, text, ingest_values, 12, 1, len);
+    count++;
+
+    strcpy(text + len, "000000000000000000000000000000000x\n");
+    passed += run_ingest_case("binary lines then 32 digits and 0x", ingestBinWordsUsing, text, ingest_values, 12, 1, len);
+    count++;
+
+    strcpy(text + len, "000000000000000000000000000000001\n");
+    passed += run_ingest_case("binary lines then 33 digits", ingestBinWordsUsing, text, ingest_values, 12, 1, len);
+    count++;
+
+    len = (size_t)(bin_lines(text, ingest_values, 12, 1, "\n") - text);
+    strcpy(text + len, "0000 0000 0000 0000 0000 0000 0000 000G\n");
+    passed += run_ingest_case("grouped binary lines then a G", ingestBinWordsUsing, text, ingest_values, 12, 1, len);
+    count++;
+
+    strcpy(text + len, "0000 0000 0000 0000 0000 0000 0000 0000 0001\n");
+    passed += run_ingest_case("grouped binary lines then 9 groups", ingestBinWordsUsing, text, ingest_values, 12, 1, len);
+    count++;
+
+    *num_tests += count;
+    return passed;
+}
+
+/*
+    run_decode_case
+
+    Decodes the first 'count' words with decodeMany, then each one on its own
+    with decode. Every field decodeMany fills has to match the field_ accessors,
+    and its id has to be the instruction decode picks, or OP_NONE for a word
+    decode rejects.
+
+    Returns 1 if the test passes, 0 otherwise, and prints details to stdout.
+*/
+static int run_decode_case(const char *name, const uint32_t *words, size_t count)
+{
+    static uint8_t id[DECODE_TEST_WORDS], opcode[DECODE_TEST_WORDS], rs[DECODE_TEST_WORDS], rt[DECODE_TEST_WORDS];
+    static uint8_t rd[DECODE_TEST_WORDS], shamt[DECODE_TEST_WORDS], funct[DECODE_TEST_WORDS];
+    static uint16_t imm[DECODE_TEST_WORDS];
+    Decoded_Fields fields = { id, opcode, rs, rt, rd, shamt, funct, imm };
+
+    decodeMany(words, count, &fields);
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t word = words[i];
+
+        initInstructs();
+        default_ctx.bin = word;
+        decode();
+        uint8_t expected_id = (default_ctx.status == COMPLETE_DECODE) ? (uint8_t)default_ctx.assm.id : (uint8_t)OP_NONE;
+
+        if ((id[i] != expected_id) ||
+            (opcode[i] != field_opcode(word)) || (rs[i] != field_rs(word)) || (rt[i] != field_rt(word)) ||
+            (rd[i] != field_rd(word)) || (shamt[i] != field_shamt(word)) || (funct[i] != field_funct(word)) ||
+            (imm[i] != field_imm16(word)))
+        {
+            printf("Test FAILED for input: \"%s\"\n", name);
+            printf("  Word %zu: 0x%08X\n", i, word);
+            printf("  Expected: id %u opcode %u rs %u rt %u rd %u shamt %u funct %u imm 0x%04X\n",
+                   expected_id, field_opcode(word), field_rs(word), field_rt(word), field_rd(word),
+                   field_shamt(word), field_funct(word), field_imm16(word));
+            printf("  Got:      id %u opcode %u rs %u rt %u rd %u shamt %u funct %u imm 0x%04X\n",
+                   id[i], opcode[i], rs[i], rt[i], rd[i], shamt[i], funct[i], imm[i]);
+            return 0;
+        }
+    }
+
+    printf("Test PASSED for input: \"%s\"\n", name);
+    return 1;
+}
+
+/*
+    run_decode_many_tests
+
+    Checks decodeMany against decode with:
+      - every instruction with scrambled operand bits, enough for whole AVX2
+        blocks and a tail the scalar path finishes,
+      - scrambled words, most of which aren't instructions,
+      - the ingest_values words, and a single word that only the scalar path sees.
+
+    Adds the number of cases to 'num_tests' and returns how many passed.
+*/
+static int run_decode_many_tests(int *num_tests)
+{
+    static uint32_t words[DECODE_TEST_WORDS];
+    int passed = 0;
+    int count = 0;
+
+    printf("\nRunning bulk decoding test case(s)...\n\n");
+
+    for (uint32_t i = 0; i < DECODE_TEST_WORDS; i++)
+    {
+        const struct Bit_Pattern *pattern = &patterns[i % OP_COUNT];
+        words[i] = ((i * 0x9E3779B9u) & ~pattern->mask) | pattern->match;
+    }
+    passed += run_decode_case("every instruction, 1021 words", words, DECODE_TEST_WORDS - 3);
+    count++;
+
+    for (uint32_t i = 0; i < DECODE_TEST_WORDS; i++)
+    {
+        words[i] = (i * 0x9E3779B9u) ^ (i << 7);
+    }
+    passed += run_decode_case("scrambled words, 1024 words", words, DECODE_TEST_WORDS);
+    count++;
+
+    passed += run_decode_case("ingest values, 16 words", ingest_values, 16);
+    count++;
+
+    passed += run_decode_case("one word", &ingest_values[2], 1);
+    count++;
+
+    *num_tests += count;
+    return passed;
+}
+
 /*
     run_tests
 
@@ -494,14 +1176,23 @@ void run_tests(void)
         "SW $s3, #0x24, $t4",
         "SW $a1, #0x28, $s5"
     };
-    const int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+    const int round_trips = sizeof(test_cases) / sizeof(test_cases[0]);
+    int num_tests = round_trips;
     int passed = 0;
 
-    printf("Running %d test case(s)...\n\n", num_tests);
-    for (int i = 0; i < num_tests; i++) 
+    printf("Running %d test case(s)...\n\n", round_trips);
+    for (int i = 0; i < round_trips; i++) 
     {
         if (run_test_case(test_cases[i]))
             passed++;
     }
+
+    // the cases below check results and error states a round trip can't show
+    passed += run_immediate_tests(&num_tests);
+    passed += run_register_tests(&num_tests);
+    passed += run_label_tests(&num_tests);
+    passed += run_hex_ingest_tests(&num_tests);
+    passed += run_bin_ingest_tests(&num_tests);
+    passed += run_decode_many_tests(&num_tests);
     printf("\nTest bench results: %d/%d test(s) passed.\n", passed, num_tests);
 }